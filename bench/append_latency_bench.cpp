@@ -0,0 +1,88 @@
+#include "bench.h"
+
+#include "vector.h"
+#include "incremental_vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Задержка отдельных вставок в конец: Vector и std::vector копируют все
+// элементы при перевыделении, IncrementalVector переносит их постепенно.
+// Каждый push_back измеряется отдельно; перцентили считаются по операциям
+// одного повтора, в результат идет медиана по повторам.
+
+namespace {
+
+template<typename C>
+void bench_append_latency(BenchRunner& runner, size_t n) {
+    const char* container = bench_name<C>::value;
+    if (!runner.enabled(container, "u64", "push_back latency")) {
+        return;
+    }
+
+    const BenchConfig& config = runner.config();
+    std::vector<double> samples(n);
+    std::vector<double> medians, p99s, p999s, maxes, mins, means, cycles;
+    for (size_t rep = 0; rep < config.warmup + config.repetitions; ++rep) {
+        C c;
+        uint64_t c0 = read_cycles();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < n; ++i) {
+            auto t0 = std::chrono::steady_clock::now();
+            c.push_back(i);
+            auto t1 = std::chrono::steady_clock::now();
+            samples[i] = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        }
+        auto finish = std::chrono::steady_clock::now();
+        uint64_t c1 = read_cycles();
+        do_not_optimize(c);
+        if (rep < config.warmup) {
+            continue;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        medians.push_back(sorted_percentile(samples, 50));
+        p99s.push_back(sorted_percentile(samples, 99));
+        p999s.push_back(sorted_percentile(samples, 99.9));
+        maxes.push_back(samples.back());
+        mins.push_back(samples.front());
+        means.push_back(std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(n));
+        cycles.push_back(static_cast<double>(c1 - c0) / static_cast<double>(n));
+    }
+
+    BenchResult r;
+    r.container = container;
+    r.element = "u64";
+    r.operation = "push_back latency";
+    r.size = n;
+    r.ops = n;
+    r.repetitions = config.repetitions;
+    r.median_ns = percentile(medians, 50);
+    r.p99_ns = percentile(p99s, 50);
+    r.p999_ns = percentile(p999s, 50);
+    r.max_ns = percentile(maxes, 50);
+    r.min_ns = percentile(mins, 50);
+    r.ns_per_op = percentile(means, 50);
+    r.cycles_per_op = percentile(cycles, 50);
+    runner.record(r);
+}
+
+} // namespace
+
+BENCH_SUITE(append_latency) {
+    for (size_t n : runner.sizes()) {
+        // На малых размерах p99.9 совпадает с худшей операцией
+        if (n < 10000) {
+            continue;
+        }
+        // Оба буфера IncrementalVector плюс выборка времен
+        if (!runner.fits(n * (3 * sizeof(uint64_t) + 2 * sizeof(double)))) {
+            continue;
+        }
+        bench_append_latency<Vector<uint64_t>>(runner, n);
+        bench_append_latency<std::vector<uint64_t>>(runner, n);
+        bench_append_latency<IncrementalVector<uint64_t>>(runner, n);
+    }
+}
@@ -0,0 +1,86 @@
+#include "bench.h"
+
+#include "compact_list.h"
+#include "container_stats.h"
+#include "deque.h"
+#include "forward_list.h"
+#include "gap_vector.h"
+#include "list.h"
+#include "vector.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+// Цикл снимков: источник меняется, и его содержимое раз за разом копируется
+// в один и тот же приемник. "copy construct" - каждый снимок новой копией
+// (все узлы или буфер выделяются заново), "copy assign" - присваиванием
+// приемнику, уже имеющему снимок такого же размера: узлы и буфер
+// переиспользуются, и выделений памяти в установившемся режиме нет.
+// Операция - один снимок; выделения считаются через ContainerStats.
+
+namespace {
+
+template<typename T>
+using Alloc = std::allocator<T>;
+
+template<typename C>
+struct Snapshots {
+    C source;
+    C target;
+    size_t copy_allocations = 0;  // Выделения копий, созданных конструктором
+};
+
+template<typename C>
+void bench_assign(BenchRunner& runner, size_t n) {
+    using State = std::optional<Snapshots<C>>;
+    const char* name = bench_name<C>::value;
+    // На малых размерах снимков больше, чтобы замер не тонул в шуме таймера
+    size_t rounds = n < 100000 ? 100000 / n : 1;
+
+    auto setup = [n] {
+        State state(std::in_place);
+        fill_back(state->source, n);
+        state->target = state->source;
+        return state;
+    };
+    auto allocations = [](State& s) { return s->target.stats().allocations + s->copy_allocations; };
+
+    runner.run(name, "u32", "copy construct", n, rounds, setup,
+               [rounds](State& s) {
+                   for (size_t round = 0; round < rounds; ++round) {
+                       s->source.front() = static_cast<uint32_t>(round);
+                       C copy(s->source);
+                       do_not_optimize(copy);
+                       s->copy_allocations += copy.stats().allocations;
+                   }
+               },
+               allocations);
+
+    runner.run(name, "u32", "copy assign", n, rounds, setup,
+               [rounds](State& s) {
+                   for (size_t round = 0; round < rounds; ++round) {
+                       s->source.front() = static_cast<uint32_t>(round);
+                       s->target = s->source;
+                       do_not_optimize(s->target);
+                   }
+               },
+               allocations);
+}
+
+} // namespace
+
+BENCH_SUITE(assign) {
+    for (size_t n : runner.sizes()) {
+        // Источник и приемник со списочными узлами, плюс копия
+        if (!runner.fits(n * (sizeof(uint32_t) + 2 * sizeof(void*)) * 3 * 2)) {
+            continue;
+        }
+        bench_assign<Vector<uint32_t, Alloc<uint32_t>, ContainerStats>>(runner, n);
+        bench_assign<List<uint32_t, Alloc<uint32_t>, ContainerStats>>(runner, n);
+        bench_assign<ForwardList<uint32_t, Alloc<uint32_t>, ContainerStats>>(runner, n);
+        bench_assign<Deque<uint32_t, Alloc<uint32_t>, ContainerStats>>(runner, n);
+        bench_assign<GapVector<uint32_t, Alloc<uint32_t>, ContainerStats>>(runner, n);
+        bench_assign<CompactList<uint32_t, Alloc<uint32_t>, ContainerStats>>(runner, n);
+    }
+}
@@ -0,0 +1,424 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "compact_list.h"
+#include "deque.h"
+#include "forward_list.h"
+#include "gap_vector.h"
+#include "incremental_vector.h"
+#include "list.h"
+#include "vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <forward_list>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Небольшой самодостаточный каркас для микробенчмарков: прогрев, повторы,
+// медиана и p99 по повторам, такты на операцию, вывод в text/CSV/JSON.
+
+// Не дает оптимизатору выбросить вычисление value
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Счетчик тактов процессора (TSC на x86; на других архитектурах 0)
+inline uint64_t read_cycles() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Перцентиль p (0..100) по уже отсортированной выборке
+inline double sorted_percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(p / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Перцентиль p (0..100) по выборке
+inline double percentile(std::vector<double> samples, double p) {
+    std::sort(samples.begin(), samples.end());
+    return sorted_percentile(samples, p);
+}
+
+enum class OutputFormat { Text, Csv, Json };
+
+struct BenchConfig {
+    size_t warmup = 1;                   // Повторы без записи результата
+    size_t repetitions = 5;              // Измеряемые повторы
+    size_t min_size = 10;                // Наименьший размер контейнера
+    size_t max_size = 10000000;          // Наибольший размер контейнера
+    size_t memory_budget = size_t(1) << 30;  // Оценка памяти, выше которой замер пропускается
+    std::string filter;                  // Подстрока для отбора замеров
+    OutputFormat format = OutputFormat::Text;
+};
+
+struct BenchResult {
+    std::string suite;
+    std::string container;
+    std::string element;
+    std::string operation;
+    size_t size = 0;          // Размер контейнера
+    size_t ops = 0;           // Операций за один повтор
+    size_t repetitions = 0;
+    double median_ns = 0;     // Медиана времени повтора
+    double p99_ns = 0;        // 99-й перцентиль времени повтора (или операции - для замеров задержки)
+    double p999_ns = 0;       // 99.9-й перцентиль (то же)
+    double max_ns = 0;        // Худший повтор (или операция)
+    double min_ns = 0;
+    double ns_per_op = 0;     // Медиана, деленная на число операций
+    double cycles_per_op = 0;
+    double allocations_per_op = -1;  // Выделений памяти на операцию (-1 - не считалось)
+};
+
+// Отсутствие счетчика выделений у замера
+struct NoAllocationCount {};
+
+class BenchRunner {
+private:
+    BenchConfig config_;
+    std::string suite_;
+    std::vector<BenchResult> results;
+    bool header_printed = false;
+
+    static std::string json_escape(const std::string& text) {
+        std::string out;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out;
+    }
+
+    void print(const BenchResult& r) {
+        std::ostream& out = std::cout;
+        if (config_.format == OutputFormat::Csv) {
+            if (!header_printed) {
+                out << "suite,container,element,operation,size,ops,repetitions,median_ns,p99_ns,p999_ns,max_ns,min_ns,ns_per_op,cycles_per_op,allocations_per_op\n";
+                header_printed = true;
+            }
+            out << r.suite << ',' << r.container << ',' << r.element << ',' << r.operation << ','
+                << r.size << ',' << r.ops << ',' << r.repetitions << ','
+                << std::fixed << std::setprecision(1) << r.median_ns << ',' << r.p99_ns << ',' << r.p999_ns << ',' << r.max_ns << ',' << r.min_ns << ','
+                << std::setprecision(3) << r.ns_per_op << ',' << r.cycles_per_op << ',';
+            if (r.allocations_per_op >= 0) {
+                out << r.allocations_per_op;
+            }
+            out << '\n';
+            out.flush();
+        } else if (config_.format == OutputFormat::Text) {
+            if (!header_printed) {
+                out << std::left << std::setw(16) << "suite" << std::setw(22) << "container" << std::setw(8) << "element"
+                    << std::setw(16) << "operation" << std::right << std::setw(10) << "size" << std::setw(12) << "ns/op"
+                    << std::setw(12) << "cycles/op" << std::setw(14) << "median ms" << std::setw(14) << "p99 ms" << std::setw(14) << "p99.9 ms" << std::setw(14) << "max ms" << std::setw(12) << "allocs/op" << '\n';
+                header_printed = true;
+            }
+            out << std::left << std::setw(16) << r.suite << std::setw(22) << r.container << std::setw(8) << r.element
+                << std::setw(16) << r.operation << std::right << std::setw(10) << r.size
+                << std::fixed << std::setprecision(2) << std::setw(12) << r.ns_per_op << std::setw(12) << r.cycles_per_op
+                << std::setprecision(6) << std::setw(14) << r.median_ns / 1e6 << std::setw(14) << r.p99_ns / 1e6
+                << std::setw(14) << r.p999_ns / 1e6 << std::setw(14) << r.max_ns / 1e6 << std::setw(12);
+            if (r.allocations_per_op >= 0) {
+                out << std::setprecision(2) << r.allocations_per_op;
+            } else {
+                out << "-";
+            }
+            out << '\n';
+            out.flush();
+        }
+    }
+
+public:
+    explicit BenchRunner(const BenchConfig& config) : config_(config) {}
+
+    const BenchConfig& config() const {
+        return config_;
+    }
+
+    void set_suite(const std::string& name) {
+        suite_ = name;
+    }
+
+    // Проходит ли замер фильтр --filter (подстрока набора, контейнера, типа или операции)
+    bool enabled(const std::string& container, const std::string& element, const std::string& operation) const {
+        if (config_.filter.empty()) {
+            return true;
+        }
+        std::string key = suite_ + "/" + container + "/" + element + "/" + operation;
+        return key.find(config_.filter) != std::string::npos;
+    }
+
+    // Размеры 10, 100, ..., 10^7 в пределах [min_size, max_size]
+    std::vector<size_t> sizes() const {
+        std::vector<size_t> out;
+        for (size_t n = 10; n <= config_.max_size; n *= 10) {
+            if (n >= config_.min_size) {
+                out.push_back(n);
+            }
+        }
+        return out;
+    }
+
+    bool fits(size_t bytes) const {
+        return bytes <= config_.memory_budget;
+    }
+
+    // Замер: setup() готовит состояние вне замера, body(state) измеряется.
+    // Состояние уничтожается после остановки таймера.
+    template<typename Setup, typename Body>
+    void run(const std::string& container, const std::string& element, const std::string& operation,
+             size_t size, size_t ops, Setup setup, Body body) {
+        run(container, element, operation, size, ops, setup, body, NoAllocationCount());
+    }
+
+    // То же с подсчетом выделений памяти: allocations(state) - накопленное
+    // число выделений состояния (например, из ContainerStats); в результат
+    // идет медиана по повторам прироста за body(state), деленного на ops
+    template<typename Setup, typename Body, typename Allocations>
+    void run(const std::string& container, const std::string& element, const std::string& operation,
+             size_t size, size_t ops, Setup setup, Body body, Allocations allocations) {
+        if (!enabled(container, element, operation)) {
+            return;
+        }
+        constexpr bool counted = !std::is_same<Allocations, NoAllocationCount>::value;
+        std::vector<double> times;
+        std::vector<double> cycles;
+        std::vector<double> allocation_counts;
+        for (size_t rep = 0; rep < config_.warmup + config_.repetitions; ++rep) {
+            auto state = setup();
+            size_t a0 = 0;
+            if constexpr (counted) {
+                a0 = allocations(state);
+            }
+            uint64_t c0 = read_cycles();
+            auto t0 = std::chrono::steady_clock::now();
+            body(state);
+            auto t1 = std::chrono::steady_clock::now();
+            uint64_t c1 = read_cycles();
+            do_not_optimize(state);
+            if (rep >= config_.warmup) {
+                times.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+                cycles.push_back(static_cast<double>(c1 - c0));
+                if constexpr (counted) {
+                    allocation_counts.push_back(static_cast<double>(allocations(state) - a0));
+                }
+            }
+        }
+
+        // Выборки больше не нужны: сортируем на месте, без копий для percentile()
+        std::sort(times.begin(), times.end());
+        std::sort(cycles.begin(), cycles.end());
+        std::sort(allocation_counts.begin(), allocation_counts.end());
+
+        BenchResult r;
+        r.container = container;
+        r.element = element;
+        r.operation = operation;
+        r.size = size;
+        r.ops = ops;
+        r.repetitions = config_.repetitions;
+        r.median_ns = sorted_percentile(times, 50);
+        r.p99_ns = sorted_percentile(times, 99);
+        r.p999_ns = sorted_percentile(times, 99.9);
+        r.max_ns = sorted_percentile(times, 100);
+        r.min_ns = sorted_percentile(times, 0);
+        r.ns_per_op = ops ? r.median_ns / static_cast<double>(ops) : 0;
+        r.cycles_per_op = ops ? sorted_percentile(cycles, 50) / static_cast<double>(ops) : 0;
+        if constexpr (counted) {
+            r.allocations_per_op = ops ? sorted_percentile(allocation_counts, 50) / static_cast<double>(ops) : 0;
+        }
+        record(r);
+    }
+
+    // Запись готового результата (для замеров со своей методикой, например задержек отдельных операций)
+    void record(BenchResult result) {
+        result.suite = suite_;
+        print(result);
+        results.push_back(std::move(result));
+    }
+
+    // Завершение: для JSON весь массив результатов выводится в конце
+    void finish() {
+        if (config_.format != OutputFormat::Json) {
+            return;
+        }
+        std::ostream& out = std::cout;
+        out << "[\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            out << "  {\"suite\": \"" << json_escape(r.suite) << "\", \"container\": \"" << json_escape(r.container)
+                << "\", \"element\": \"" << json_escape(r.element) << "\", \"operation\": \"" << json_escape(r.operation)
+                << "\", \"size\": " << r.size << ", \"ops\": " << r.ops << ", \"repetitions\": " << r.repetitions
+                << std::fixed << std::setprecision(1)
+                << ", \"median_ns\": " << r.median_ns << ", \"p99_ns\": " << r.p99_ns << ", \"p999_ns\": " << r.p999_ns << ", \"max_ns\": " << r.max_ns << ", \"min_ns\": " << r.min_ns
+                << std::setprecision(3)
+                << ", \"ns_per_op\": " << r.ns_per_op << ", \"cycles_per_op\": " << r.cycles_per_op;
+            if (r.allocations_per_op >= 0) {
+                out << ", \"allocations_per_op\": " << r.allocations_per_op;
+            }
+            out << "}"
+                << (i + 1 < results.size() ? "," : "") << '\n';
+        }
+        out << "]\n";
+    }
+};
+
+// Имя контейнера или типа элемента в результатах замеров
+template<typename T>
+struct bench_name;
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+struct bench_name<Vector<T, Allocator, Stats, Growth>> {
+    static constexpr const char* value = "Vector";
+};
+
+template<typename T, typename Allocator>
+struct bench_name<std::vector<T, Allocator>> {
+    static constexpr const char* value = "std::vector";
+};
+
+template<typename T, typename Allocator>
+struct bench_name<IncrementalVector<T, Allocator>> {
+    static constexpr const char* value = "IncrementalVector";
+};
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+struct bench_name<GapVector<T, Allocator, Stats, Growth>> {
+    static constexpr const char* value = "GapVector";
+};
+
+template<typename T, typename Allocator, typename Stats>
+struct bench_name<List<T, Allocator, Stats>> {
+    static constexpr const char* value = "List";
+};
+
+template<typename T, typename Allocator>
+struct bench_name<std::list<T, Allocator>> {
+    static constexpr const char* value = "std::list";
+};
+
+template<typename T, typename Allocator, typename Stats>
+struct bench_name<CompactList<T, Allocator, Stats>> {
+    static constexpr const char* value = "CompactList";
+};
+
+template<typename T, typename Allocator, typename Stats>
+struct bench_name<ForwardList<T, Allocator, Stats>> {
+    static constexpr const char* value = "ForwardList";
+};
+
+template<typename T, typename Allocator>
+struct bench_name<std::forward_list<T, Allocator>> {
+    static constexpr const char* value = "std::forward_list";
+};
+
+template<typename T, typename Allocator, typename Stats>
+struct bench_name<Deque<T, Allocator, Stats>> {
+    static constexpr const char* value = "Deque";
+};
+
+template<typename T, typename Allocator>
+struct bench_name<std::deque<T, Allocator>> {
+    static constexpr const char* value = "std::deque";
+};
+
+template<>
+struct bench_name<int> {
+    static constexpr const char* value = "i32";
+};
+
+template<>
+struct bench_name<float> {
+    static constexpr const char* value = "f32";
+};
+
+template<>
+struct bench_name<double> {
+    static constexpr const char* value = "f64";
+};
+
+// Значение i-го элемента при заполнении по умолчанию
+template<typename T>
+struct IndexValue {
+    T operator()(size_t i) const { return static_cast<T>(i); }
+};
+
+// Заполнение c значениями make(0), ..., make(n - 1) с конца
+template<typename C, typename Make = IndexValue<typename C::value_type>>
+void fill_back(C& c, size_t n, Make make = Make()) {
+    for (size_t i = 0; i < n; ++i) {
+        c.push_back(make(i));
+    }
+}
+
+// У std::forward_list нет push_back: вставка через запомненный хвост
+template<typename T, typename Allocator, typename Make = IndexValue<T>>
+void fill_back(std::forward_list<T, Allocator>& c, size_t n, Make make = Make()) {
+    auto tail = c.before_begin();
+    for (size_t i = 0; i < n; ++i) {
+        tail = c.insert_after(tail, make(i));
+    }
+}
+
+// Фикстура для BenchRunner::run: контейнер C из n элементов make(i)
+template<typename C, typename Make = IndexValue<typename C::value_type>>
+auto make_filled(size_t n, Make make = Make()) {
+    return [n, make] {
+        std::optional<C> state(std::in_place);
+        fill_back(*state, n, make);
+        return state;
+    };
+}
+
+// Регистрация наборов замеров: каждый файл bench/*_bench.cpp добавляет свои
+// наборы через BENCH_SUITE, а main() из containers_bench.cpp запускает их по очереди
+using BenchSuiteFunction = void (*)(BenchRunner&);
+
+inline std::vector<std::pair<std::string, BenchSuiteFunction>>& bench_suites() {
+    static std::vector<std::pair<std::string, BenchSuiteFunction>> suites;
+    return suites;
+}
+
+inline bool register_bench_suite(const char* name, BenchSuiteFunction function) {
+    bench_suites().emplace_back(name, function);
+    return true;
+}
+
+#define BENCH_SUITE(name)                                                                 \
+    static void bench_suite_##name(BenchRunner& runner);                                  \
+    [[maybe_unused]] static const bool bench_suite_##name##_registered = register_bench_suite(#name, bench_suite_##name); \
+    static void bench_suite_##name(BenchRunner& runner)
+
+#endif
@@ -0,0 +1,92 @@
+#include "bench.h"
+
+#include "concurrent_forward_list.h"
+#include "forward_list.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пропускная способность ConcurrentForwardList против ForwardList под мьютексом.
+// Каждый поток поочередно вставляет и извлекает элементы в начале общего
+// списка; в колонке size - число потоков, ops - операций на все потоки.
+
+namespace {
+
+// ForwardList под одним мьютексом - то, чем ConcurrentForwardList заменяет
+struct LockedForwardList {
+    std::mutex mutex;
+    ForwardList<int> list;
+
+    void push_front(int value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.push_front(value);
+    }
+
+    bool pop_front(int& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.empty()) {
+            return false;
+        }
+        value = *list.begin();
+        list.pop_front();
+        return true;
+    }
+};
+
+struct LockFreeForwardList {
+    ConcurrentForwardList<int> list;
+
+    void push_front(int value) {
+        list.push_front(value);
+    }
+
+    bool pop_front(int& value) {
+        if (std::optional<int> popped = list.pop_front()) {
+            value = *popped;
+            return true;
+        }
+        return false;
+    }
+};
+
+template<typename C>
+void bench_throughput(BenchRunner& runner, const char* container, size_t threads, size_t total_ops) {
+    size_t per_thread = total_ops / threads / 2;
+    runner.run(container, "int", "push+pop", threads, per_thread * threads * 2,
+               [] { return std::make_unique<C>(); },
+               [&](std::unique_ptr<C>& list) {
+                   std::atomic<bool> start{false};
+                   std::vector<std::thread> workers;
+                   for (size_t t = 0; t < threads; ++t) {
+                       workers.emplace_back([&, t] {
+                           while (!start.load(std::memory_order_acquire)) {
+                               std::this_thread::yield();
+                           }
+                           int value = 0;
+                           for (size_t i = 0; i < per_thread; ++i) {
+                               list->push_front(static_cast<int>(t + i));
+                               list->pop_front(value);
+                           }
+                           do_not_optimize(value);
+                       });
+                   }
+                   start.store(true, std::memory_order_release);
+                   for (std::thread& worker : workers) {
+                       worker.join();
+                   }
+               });
+}
+
+} // namespace
+
+BENCH_SUITE(concurrent) {
+    size_t total_ops = std::max<size_t>(runner.config().max_size / 10, 1000);
+    for (size_t threads = 1; threads <= 32; threads *= 2) {
+        bench_throughput<LockedForwardList>(runner, "ForwardList+mutex", threads, total_ops);
+        bench_throughput<LockFreeForwardList>(runner, "ConcurrentForwardList", threads, total_ops);
+    }
+}
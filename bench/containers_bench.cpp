@@ -0,0 +1,353 @@
+#include "bench.h"
+
+#include "vector.h"
+#include "list.h"
+#include "compact_list.h"
+#include "forward_list.h"
+#include "deque.h"
+
+#include <cstring>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Сравнение Vector, List, CompactList, ForwardList и Deque с std::vector,
+// std::list, std::forward_list и std::deque
+
+namespace {
+
+// 64-байтная POD-структура
+struct Pod64 {
+    uint64_t values[8];
+};
+
+template<typename T>
+struct ElementTraits;
+
+template<>
+struct ElementTraits<int> {
+    static const char* name() { return "int"; }
+    static int make(size_t i) { return static_cast<int>(i); }
+    static size_t weight(const int& value) { return static_cast<size_t>(value); }
+    static size_t heap_bytes() { return 0; }
+};
+
+template<>
+struct ElementTraits<Pod64> {
+    static const char* name() { return "pod64"; }
+    static Pod64 make(size_t i) {
+        Pod64 pod;
+        for (uint64_t& v : pod.values) {
+            v = i;
+        }
+        return pod;
+    }
+    static size_t weight(const Pod64& value) { return static_cast<size_t>(value.values[0]); }
+    static size_t heap_bytes() { return 0; }
+};
+
+template<>
+struct ElementTraits<std::string> {
+    static const char* name() { return "string"; }
+    // Строка длиннее буфера малых строк, чтобы каждая копия выделяла память
+    static std::string make(size_t i) { return "element-string-" + std::to_string(i) + "-padding"; }
+    static size_t weight(const std::string& value) { return value.size(); }
+    static size_t heap_bytes() { return 48; }
+};
+
+// Единый интерфейс к тестируемым контейнерам. Позиционные операции выполняются
+// так, как их естественно записать для каждого контейнера.
+template<typename C>
+struct ContainerOps;
+
+template<typename T>
+struct ContainerOps<Vector<T>> {
+    static constexpr bool quadratic_push_front = true;
+    static void push_back(Vector<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(Vector<T>& c, T v) { c.insert(0, std::move(v)); }
+    static void insert(Vector<T>& c, size_t pos, T v) { c.insert(pos, std::move(v)); }
+    static void erase(Vector<T>& c, size_t pos) { c.erase(pos); }
+};
+
+template<typename T>
+struct ContainerOps<std::vector<T>> {
+    static constexpr bool quadratic_push_front = true;
+    static void push_back(std::vector<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(std::vector<T>& c, T v) { c.insert(c.begin(), std::move(v)); }
+    static void insert(std::vector<T>& c, size_t pos, T v) { c.insert(c.begin() + pos, std::move(v)); }
+    static void erase(std::vector<T>& c, size_t pos) { c.erase(c.begin() + pos); }
+};
+
+template<typename T>
+struct ContainerOps<List<T>> {
+    static constexpr bool quadratic_push_front = false;
+    static void push_back(List<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(List<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(List<T>& c, size_t pos, T v) { c.insert(pos, std::move(v)); }
+    static void erase(List<T>& c, size_t pos) { c.erase(pos); }
+};
+
+template<typename T>
+struct ContainerOps<std::list<T>> {
+    static constexpr bool quadratic_push_front = false;
+    // Позиция ищется от ближайшего конца
+    static typename std::list<T>::iterator at(std::list<T>& c, size_t pos) {
+        size_t n = c.size();
+        return pos <= n / 2 ? std::next(c.begin(), pos) : std::prev(c.end(), n - pos);
+    }
+    static void push_back(std::list<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(std::list<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(std::list<T>& c, size_t pos, T v) { c.insert(at(c, pos), std::move(v)); }
+    static void erase(std::list<T>& c, size_t pos) { c.erase(at(c, pos)); }
+};
+
+template<typename T>
+struct ContainerOps<CompactList<T>> {
+    static constexpr bool quadratic_push_front = false;
+    static void push_back(CompactList<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(CompactList<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(CompactList<T>& c, size_t pos, T v) { c.insert(pos, std::move(v)); }
+    static void erase(CompactList<T>& c, size_t pos) { c.erase(pos); }
+};
+
+template<typename T>
+struct ContainerOps<ForwardList<T>> {
+    static constexpr bool quadratic_push_front = false;
+    static void push_back(ForwardList<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(ForwardList<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(ForwardList<T>& c, size_t pos, T v) { c.insert(pos, std::move(v)); }
+    static void erase(ForwardList<T>& c, size_t pos) { c.erase(pos); }
+};
+
+template<typename T>
+struct ContainerOps<std::forward_list<T>> {
+    static constexpr bool quadratic_push_front = false;
+    // У std::forward_list нет push_back и size(): конец ищется проходом от начала
+    static void push_back(std::forward_list<T>& c, T v) {
+        auto last = c.before_begin();
+        for (auto it = c.begin(); it != c.end(); ++it) {
+            last = it;
+        }
+        c.insert_after(last, std::move(v));
+    }
+    static void push_front(std::forward_list<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(std::forward_list<T>& c, size_t pos, T v) {
+        c.insert_after(std::next(c.before_begin(), pos), std::move(v));
+    }
+    static void erase(std::forward_list<T>& c, size_t pos) { c.erase_after(std::next(c.before_begin(), pos)); }
+};
+
+template<typename T>
+struct ContainerOps<Deque<T>> {
+    static constexpr bool quadratic_push_front = false;
+    static void push_back(Deque<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(Deque<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(Deque<T>& c, size_t pos, T v) { c.insert(pos, std::move(v)); }
+    static void erase(Deque<T>& c, size_t pos) { c.erase(pos); }
+};
+
+template<typename T>
+struct ContainerOps<std::deque<T>> {
+    static constexpr bool quadratic_push_front = false;
+    static void push_back(std::deque<T>& c, T v) { c.push_back(std::move(v)); }
+    static void push_front(std::deque<T>& c, T v) { c.push_front(std::move(v)); }
+    static void insert(std::deque<T>& c, size_t pos, T v) { c.insert(c.begin() + pos, std::move(v)); }
+    static void erase(std::deque<T>& c, size_t pos) { c.erase(c.begin() + pos); }
+};
+
+// Число позиционных операций за повтор: не больше 1000 и так, чтобы
+// повтор с линейной стоимостью операции оставался в пределах ~10^6 шагов
+size_t positional_ops(size_t n) {
+    size_t k = 1000000 / n;
+    if (k > 1000) {
+        k = 1000;
+    }
+    if (k > n) {
+        k = n;
+    }
+    return k == 0 ? 1 : k;
+}
+
+template<typename C, typename T>
+void bench_container(BenchRunner& runner) {
+    using Ops = ContainerOps<C>;
+    const std::string container = bench_name<C>::value;
+    const std::string element = ElementTraits<T>::name();
+    using State = std::optional<C>;
+
+    for (size_t n : runner.sizes()) {
+        // Оценка пиковой памяти: исходный контейнер и его копия
+        size_t footprint = n * (sizeof(T) + 32 + ElementTraits<T>::heap_bytes()) * 2;
+        if (!runner.fits(footprint)) {
+            continue;
+        }
+
+        auto empty = [] { return State(std::in_place); };
+        auto filled = make_filled<C>(n, ElementTraits<T>::make);
+
+        runner.run(container, element, "push_back", n, n, empty, [n](State& s) {
+            fill_back(*s, n, ElementTraits<T>::make);
+        });
+
+        // Квадратичную вставку в начало вектора ограничиваем объемом сдвигаемых байт
+        if (!Ops::quadratic_push_front || static_cast<double>(n) * n * sizeof(T) <= 4e10) {
+            runner.run(container, element, "push_front", n, n, empty, [n](State& s) {
+                for (size_t i = 0; i < n; ++i) {
+                    Ops::push_front(*s, ElementTraits<T>::make(i));
+                }
+            });
+        }
+
+        size_t k = positional_ops(n);
+        struct Position {
+            const char* suffix;
+            size_t (*pick)(size_t size);
+        };
+        const Position positions[] = {
+            {"front", [](size_t) -> size_t { return 0; }},
+            {"middle", [](size_t size) -> size_t { return size / 2; }},
+            {"back", [](size_t size) -> size_t { return size; }},
+        };
+        for (const Position& position : positions) {
+            runner.run(container, element, std::string("insert_") + position.suffix, n, k, filled,
+                       [n, k, &position](State& s) {
+                           for (size_t i = 0; i < k; ++i) {
+                               Ops::insert(*s, position.pick(n + i), ElementTraits<T>::make(i));
+                           }
+                       });
+            runner.run(container, element, std::string("erase_") + position.suffix, n, k, filled,
+                       [n, k, &position](State& s) {
+                           for (size_t i = 0; i < k; ++i) {
+                               size_t size = n - i;
+                               size_t pos = position.pick(size);
+                               Ops::erase(*s, pos == size ? size - 1 : pos);
+                           }
+                       });
+        }
+
+        runner.run(container, element, "iterate", n, n, filled, [](State& s) {
+            size_t sum = 0;
+            for (auto it = s->begin(); it != s->end(); ++it) {
+                sum += ElementTraits<T>::weight(*it);
+            }
+            do_not_optimize(sum);
+        });
+
+        runner.run(container, element, "copy", n, n, filled, [](State& s) {
+            C copy(*s);
+            do_not_optimize(copy);
+        });
+
+        const size_t moves = 100;
+        runner.run(container, element, "move", n, moves, filled, [moves](State& s) {
+            for (size_t i = 0; i < moves; ++i) {
+                C moved(std::move(*s));
+                *s = std::move(moved);
+            }
+        });
+
+        runner.run(container, element, "clear", n, n, filled, [](State& s) {
+            s->clear();
+        });
+    }
+}
+
+template<typename T>
+void bench_element(BenchRunner& runner) {
+    bench_container<Vector<T>, T>(runner);
+    bench_container<std::vector<T>, T>(runner);
+    bench_container<List<T>, T>(runner);
+    bench_container<std::list<T>, T>(runner);
+    bench_container<CompactList<T>, T>(runner);
+    bench_container<ForwardList<T>, T>(runner);
+    bench_container<std::forward_list<T>, T>(runner);
+    bench_container<Deque<T>, T>(runner);
+    bench_container<std::deque<T>, T>(runner);
+}
+
+} // namespace
+
+BENCH_SUITE(containers) {
+    bench_element<int>(runner);
+    bench_element<Pod64>(runner);
+    bench_element<std::string>(runner);
+}
+
+namespace {
+
+void print_usage() {
+    std::cout << "Использование: containers_bench [параметры]\n"
+                 "  --format=text|csv|json  формат вывода (по умолчанию text)\n"
+                 "  --min-size=N            наименьший размер контейнера (по умолчанию 10)\n"
+                 "  --max-size=N            наибольший размер контейнера (по умолчанию 10000000)\n"
+                 "  --reps=N                число измеряемых повторов (по умолчанию 5)\n"
+                 "  --warmup=N              число прогревочных повторов (по умолчанию 1)\n"
+                 "  --memory-mb=N           пропускать замеры, требующие больше N МБ (по умолчанию 1024)\n"
+                 "  --filter=STR            запускать только замеры, в имени которых есть STR\n"
+                 "                          (имя: набор/контейнер/тип/операция)\n";
+}
+
+bool parse_option(const std::string& arg, const char* name, std::string& value) {
+    std::string prefix = std::string(name) + "=";
+    if (arg.compare(0, prefix.size(), prefix) == 0) {
+        value = arg.substr(prefix.size());
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        if (parse_option(arg, "--format", value)) {
+            if (value == "csv") {
+                config.format = OutputFormat::Csv;
+            } else if (value == "json") {
+                config.format = OutputFormat::Json;
+            } else if (value == "text") {
+                config.format = OutputFormat::Text;
+            } else {
+                std::cerr << "Неизвестный формат: " << value << std::endl;
+                return 1;
+            }
+        } else if (parse_option(arg, "--min-size", value)) {
+            config.min_size = std::stoull(value);
+        } else if (parse_option(arg, "--max-size", value)) {
+            config.max_size = std::stoull(value);
+        } else if (parse_option(arg, "--reps", value)) {
+            config.repetitions = std::stoull(value);
+        } else if (parse_option(arg, "--warmup", value)) {
+            config.warmup = std::stoull(value);
+        } else if (parse_option(arg, "--memory-mb", value)) {
+            config.memory_budget = std::stoull(value) << 20;
+        } else if (parse_option(arg, "--filter", value)) {
+            config.filter = value;
+        } else if (arg == "--help" || arg == "-h") {
+            print_usage();
+            return 0;
+        } else {
+            std::cerr << "Неизвестный параметр: " << arg << std::endl;
+            print_usage();
+            return 1;
+        }
+    }
+    if (config.repetitions == 0) {
+        config.repetitions = 1;
+    }
+
+    BenchRunner runner(config);
+    for (const auto& suite : bench_suites()) {
+        runner.set_suite(suite.first);
+        suite.second(runner);
+    }
+    runner.finish();
+    return 0;
+}
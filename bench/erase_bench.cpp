@@ -0,0 +1,81 @@
+#include "bench.h"
+
+#include "forward_list.h"
+#include "list.h"
+#include "vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Удаление 1%, 10% и 50% элементов в случайных позициях: erase_indices за
+// один проход против erase(pos) по одному (по убыванию позиций, чтобы
+// оставшиеся позиции не сдвигались), для Vector, List и ForwardList.
+
+namespace {
+
+// k различных позиций из [0, n) в случайном порядке
+std::vector<size_t> random_positions(size_t n, size_t k) {
+    std::mt19937_64 rng(n * 31 + k);
+    std::vector<size_t> all(n);
+    std::iota(all.begin(), all.end(), size_t(0));
+    for (size_t i = 0; i < k; ++i) {
+        std::swap(all[i], all[i + rng() % (n - i)]);
+    }
+    all.resize(k);
+    return all;
+}
+
+template<typename C>
+void bench_erase(BenchRunner& runner, size_t n, size_t percent) {
+    using State = std::optional<C>;
+    size_t k = n * percent / 100;
+    if (k == 0) {
+        return;
+    }
+    std::vector<size_t> positions = random_positions(n, k);
+    std::vector<size_t> descending = positions;
+    std::sort(descending.begin(), descending.end(), std::greater<size_t>());
+
+    auto filled = make_filled<C>(n);
+    const std::string suffix = " " + std::to_string(percent) + "%";
+
+    runner.run(bench_name<C>::value, "u32", "erase_indices" + suffix, n, k, filled,
+               [&positions](State& s) {
+                   s->erase_indices(positions.begin(), positions.end());
+                   do_not_optimize(*s);
+               });
+
+    // Удаление по одному стоит O(k * n): на больших размерах пропускается
+    if (static_cast<double>(k) * static_cast<double>(n) <= 1e9) {
+        runner.run(bench_name<C>::value, "u32", "erase one by one" + suffix, n, k, filled,
+                   [&descending](State& s) {
+                       for (size_t pos : descending) {
+                           s->erase(pos);
+                       }
+                       do_not_optimize(*s);
+                   });
+    }
+}
+
+} // namespace
+
+BENCH_SUITE(erase) {
+    const size_t percents[] = {1, 10, 50};
+    for (size_t n : runner.sizes()) {
+        // Узлы List: элемент и два указателя; плюс набор позиций
+        if (!runner.fits(n * (sizeof(uint32_t) + 2 * sizeof(void*) + 3 * sizeof(size_t)) * 2)) {
+            continue;
+        }
+        for (size_t percent : percents) {
+            bench_erase<Vector<uint32_t>>(runner, n, percent);
+            bench_erase<List<uint32_t>>(runner, n, percent);
+            bench_erase<ForwardList<uint32_t>>(runner, n, percent);
+        }
+    }
+}
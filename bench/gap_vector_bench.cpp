@@ -0,0 +1,93 @@
+#include "bench.h"
+
+#include "gap_vector.h"
+#include "list.h"
+#include "vector.h"
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+// Правки рядом с курсором, как в текстовом редакторе: набор (вставка в
+// позицию курсора), удаление символа перед курсором, небольшие сдвиги
+// курсора и редкие переходы в случайное место. Один и тот же след правок
+// применяется к GapVector, Vector и List, заполненным n элементами.
+
+namespace {
+
+struct Edit {
+    bool insert;  // Вставка (true) или удаление (false)
+    size_t pos;   // Позиция правки
+};
+
+// След из count правок над последовательностью длины n; курсор начинает с середины
+std::vector<Edit> make_edit_trace(size_t n, size_t count) {
+    std::mt19937_64 rng(n);
+    std::vector<Edit> trace;
+    trace.reserve(count);
+    size_t size = n;
+    size_t cursor = n / 2;
+    while (trace.size() < count) {
+        unsigned roll = static_cast<unsigned>(rng() % 100);
+        if (roll < 70) {
+            trace.push_back({true, cursor});  // Набор
+            ++cursor;
+            ++size;
+        } else if (roll < 90) {
+            if (cursor > 0) {
+                --cursor;                      // Удаление перед курсором
+                trace.push_back({false, cursor});
+                --size;
+            }
+        } else if (roll < 99) {
+            size_t step = 1 + rng() % 16;      // Сдвиг курсора
+            cursor = rng() % 2 ? std::min(size, cursor + step) : (cursor > step ? cursor - step : 0);
+        } else {
+            cursor = rng() % (size + 1);       // Переход в случайное место
+        }
+    }
+    return trace;
+}
+
+// Правок за повтор: для Vector каждая стоит O(n), поэтому на больших
+// размерах след короче
+size_t trace_length(size_t n) {
+    size_t k = 100000000 / n;
+    if (k > 10000) {
+        k = 10000;
+    }
+    return k < 100 ? 100 : k;
+}
+
+template<typename C>
+void bench_edits(BenchRunner& runner, size_t n, const std::vector<Edit>& trace) {
+    using State = std::optional<C>;
+    runner.run(bench_name<C>::value, "u32", "cursor edits", n, trace.size(), make_filled<C>(n),
+               [&trace](State& s) {
+                   uint32_t value = 0;
+                   for (const Edit& edit : trace) {
+                       if (edit.insert) {
+                           s->insert(edit.pos, value++);
+                       } else {
+                           s->erase(edit.pos);
+                       }
+                   }
+                   do_not_optimize(*s);
+               });
+}
+
+} // namespace
+
+BENCH_SUITE(gap_vector) {
+    for (size_t n : runner.sizes()) {
+        // Узлы List занимают больше всего: элемент и два указателя
+        if (!runner.fits(n * (sizeof(uint32_t) + 2 * sizeof(void*)) * 2)) {
+            continue;
+        }
+        std::vector<Edit> trace = make_edit_trace(n, trace_length(n));
+        bench_edits<GapVector<uint32_t>>(runner, n, trace);
+        bench_edits<Vector<uint32_t>>(runner, n, trace);
+        bench_edits<List<uint32_t>>(runner, n, trace);
+    }
+}
@@ -0,0 +1,177 @@
+#include "bench.h"
+
+#include "intrusive_list.h"
+#include "list.h"
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+// List<Payload> против IntrusiveList<Payload> над заранее созданными
+// объектами: связывание n объектов, перестановка случайного объекта в конец
+// (List - удаление по сохраненному итератору и вставка копии, IntrusiveList -
+// отвязывание по ссылке и повторное связывание) и проход с суммированием.
+
+namespace {
+
+struct Payload {
+    uint64_t key;
+    uint64_t data[3];
+    ListHook hook;
+};
+
+using Intrusive = IntrusiveList<Payload, &Payload::hook>;
+
+std::vector<Payload> make_payloads(size_t n) {
+    std::vector<Payload> payloads(n);
+    for (size_t i = 0; i < n; ++i) {
+        payloads[i].key = i;
+    }
+    return payloads;
+}
+
+// Порядок перестановок: один и тот же для обоих списков
+std::vector<uint32_t> make_picks(size_t n, size_t count) {
+    std::mt19937 rng(static_cast<unsigned>(n));
+    std::vector<uint32_t> picks(count);
+    for (uint32_t& pick : picks) {
+        pick = static_cast<uint32_t>(rng() % n);
+    }
+    return picks;
+}
+
+struct ListState {
+    List<Payload> list;
+    std::vector<List<Payload>::iterator> positions;  // Узел каждого объекта по ключу
+};
+
+struct IntrusiveState {
+    std::vector<Payload> payloads;
+    Intrusive list;
+};
+
+void bench_link(BenchRunner& runner, size_t n) {
+    using ListOpt = std::optional<std::pair<std::vector<Payload>, List<Payload>>>;
+    runner.run("List", "payload", "link n", n, n,
+               [n] { return ListOpt(std::in_place, make_payloads(n), List<Payload>()); },
+               [](ListOpt& s) {
+                   for (const Payload& payload : s->first) {
+                       s->second.push_back(payload);
+                   }
+                   do_not_optimize(s->second);
+               });
+
+    using IntrusiveOpt = std::optional<IntrusiveState>;
+    runner.run("IntrusiveList", "payload", "link n", n, n,
+               [n] { return IntrusiveOpt(IntrusiveState{make_payloads(n), Intrusive()}); },
+               [](IntrusiveOpt& s) {
+                   for (Payload& payload : s->payloads) {
+                       s->list.push_back(payload);
+                   }
+                   do_not_optimize(s->list);
+               });
+}
+
+void bench_move_to_back(BenchRunner& runner, size_t n, const std::vector<uint32_t>& picks) {
+    using ListOpt = std::optional<ListState>;
+    runner.run("List", "payload", "move to back", n, picks.size(),
+               [n] {
+                   ListOpt state(std::in_place);
+                   std::vector<Payload> payloads = make_payloads(n);
+                   for (const Payload& payload : payloads) {
+                       state->list.push_back(payload);
+                       state->positions.push_back(std::prev(state->list.end()));
+                   }
+                   return state;
+               },
+               [&picks](ListOpt& s) {
+                   for (uint32_t pick : picks) {
+                       Payload payload = *s->positions[pick];
+                       s->list.erase(s->positions[pick]);
+                       s->list.push_back(payload);
+                       s->positions[pick] = std::prev(s->list.end());
+                   }
+                   do_not_optimize(s->list);
+               });
+
+    using IntrusiveOpt = std::optional<IntrusiveState>;
+    runner.run("IntrusiveList", "payload", "move to back", n, picks.size(),
+               [n] {
+                   IntrusiveOpt state(IntrusiveState{make_payloads(n), Intrusive()});
+                   for (Payload& payload : state->payloads) {
+                       state->list.push_back(payload);
+                   }
+                   return state;
+               },
+               [&picks](IntrusiveOpt& s) {
+                   for (uint32_t pick : picks) {
+                       Payload& payload = s->payloads[pick];
+                       s->list.unlink(payload);
+                       s->list.push_back(payload);
+                   }
+                   do_not_optimize(s->list);
+               });
+}
+
+void bench_iterate(BenchRunner& runner, size_t n, const std::vector<uint32_t>& picks) {
+    // Проход по списку после перестановок: порядок объектов в памяти перемешан
+    using ListOpt = std::optional<List<Payload>>;
+    runner.run("List", "payload", "iterate", n, n,
+               [n, &picks] {
+                   ListOpt state(std::in_place);
+                   std::vector<List<Payload>::iterator> positions;
+                   std::vector<Payload> payloads = make_payloads(n);
+                   for (const Payload& payload : payloads) {
+                       state->push_back(payload);
+                       positions.push_back(std::prev(state->end()));
+                   }
+                   for (uint32_t pick : picks) {
+                       state->splice(state->end(), *state, positions[pick]);
+                   }
+                   return state;
+               },
+               [](ListOpt& s) {
+                   uint64_t sum = 0;
+                   for (const Payload& payload : *s) {
+                       sum += payload.key;
+                   }
+                   do_not_optimize(sum);
+               });
+
+    using IntrusiveOpt = std::optional<IntrusiveState>;
+    runner.run("IntrusiveList", "payload", "iterate", n, n,
+               [n, &picks] {
+                   IntrusiveOpt state(IntrusiveState{make_payloads(n), Intrusive()});
+                   for (Payload& payload : state->payloads) {
+                       state->list.push_back(payload);
+                   }
+                   for (uint32_t pick : picks) {
+                       state->list.splice(state->list.end(), state->list,
+                                          state->list.iterator_to(state->payloads[pick]));
+                   }
+                   return state;
+               },
+               [](IntrusiveOpt& s) {
+                   uint64_t sum = 0;
+                   for (const Payload& payload : s->list) {
+                       sum += payload.key;
+                   }
+                   do_not_optimize(sum);
+               });
+}
+
+} // namespace
+
+BENCH_SUITE(intrusive) {
+    for (size_t n : runner.sizes()) {
+        // Объекты, узлы List с копиями и вектор итераторов
+        if (!runner.fits(n * (2 * sizeof(Payload) + 3 * sizeof(void*)) * 2)) {
+            continue;
+        }
+        std::vector<uint32_t> picks = make_picks(n, n < 10000 ? 10000 : n);
+        bench_link(runner, n);
+        bench_move_to_back(runner, n, picks);
+        bench_iterate(runner, n, picks);
+    }
+}
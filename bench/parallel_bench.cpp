@@ -0,0 +1,133 @@
+#include "bench.h"
+
+#include "parallel_algorithms.h"
+#include "vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+
+// Масштабирование параллельных алгоритмов над Vector<uint64_t>: обычный
+// последовательный цикл против parallel:: на пулах из 1, 2, 4, ... потоков
+// (до числа аппаратных потоков). Пул создается вне замера.
+
+namespace {
+
+using Data = Vector<uint64_t>;
+
+Data make_data(size_t n) {
+    std::mt19937_64 rng(42);
+    Data data;
+    data.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        data.push_back(rng() % 1000000);
+    }
+    return data;
+}
+
+// Небольшая вычислительная нагрузка на элемент, чтобы for_each и transform
+// упирались не только в пропускную способность памяти
+uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+void bench_sequential(BenchRunner& runner, const Data& source, size_t n) {
+    const char* container = "sequential";
+    runner.run(container, "u64", "for_each", n, n,
+               [&] { return source; },
+               [](Data& data) {
+                   for (size_t i = 0; i < data.size(); ++i) {
+                       data[i] = mix(data[i]);
+                   }
+               });
+    runner.run(container, "u64", "transform", n, n,
+               [&] { return std::make_unique<Data>(source.size()); },
+               [&](std::unique_ptr<Data>& out) {
+                   for (size_t i = 0; i < source.size(); ++i) {
+                       (*out)[i] = mix(source[i]);
+                   }
+               });
+    runner.run(container, "u64", "reduce", n, n,
+               [] { return uint64_t(0); },
+               [&](uint64_t& sum) {
+                   for (size_t i = 0; i < source.size(); ++i) {
+                       sum += source[i];
+                   }
+               });
+    runner.run(container, "u64", "count_if", n, n,
+               [] { return size_t(0); },
+               [&](size_t& count) {
+                   for (size_t i = 0; i < source.size(); ++i) {
+                       count += source[i] % 3 == 0;
+                   }
+               });
+    runner.run(container, "u64", "inclusive_scan", n, n,
+               [&] { return std::make_unique<Data>(source.size()); },
+               [&](std::unique_ptr<Data>& out) {
+                   std::inclusive_scan(&source[0], &source[0] + n, &(*out)[0]);
+               });
+    runner.run(container, "u64", "sort", n, n,
+               [&] { return source; },
+               [](Data& data) { std::sort(&data[0], &data[0] + data.size()); });
+}
+
+void bench_parallel(BenchRunner& runner, const Data& source, size_t n, size_t threads) {
+    std::string container = "parallel/" + std::to_string(threads);
+    ThreadPool pool(threads);
+    parallel::Options options;
+    options.pool = &pool;
+
+    runner.run(container, "u64", "for_each", n, n,
+               [&] { return source; },
+               [&](Data& data) { parallel::for_each(data, [](uint64_t& x) { x = mix(x); }, options); });
+    runner.run(container, "u64", "transform", n, n,
+               [&] { return std::make_unique<Data>(source.size()); },
+               [&](std::unique_ptr<Data>& out) {
+                   parallel::transform(source, *out, [](uint64_t x) { return mix(x); }, options);
+               });
+    runner.run(container, "u64", "reduce", n, n,
+               [] { return uint64_t(0); },
+               [&](uint64_t& sum) { sum = parallel::reduce(source, uint64_t(0), std::plus<>(), options); });
+    runner.run(container, "u64", "count_if", n, n,
+               [] { return size_t(0); },
+               [&](size_t& count) {
+                   count = parallel::count_if(source, [](uint64_t x) { return x % 3 == 0; }, options);
+               });
+    runner.run(container, "u64", "inclusive_scan", n, n,
+               [&] { return std::make_unique<Data>(source.size()); },
+               [&](std::unique_ptr<Data>& out) { parallel::inclusive_scan(source, *out, std::plus<>(), options); });
+    runner.run(container, "u64", "sort", n, n,
+               [&] { return source; },
+               [&](Data& data) { parallel::sort(data, std::less<>(), options); });
+}
+
+} // namespace
+
+BENCH_SUITE(parallel) {
+    size_t max_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    for (size_t n : runner.sizes()) {
+        // Меньшие диапазоны укладываются в один блок и выполняются последовательно
+        if (n < 100000) {
+            continue;
+        }
+        // Исходные данные, копия в замере и буфер сортировки
+        if (!runner.fits(n * 3 * sizeof(uint64_t))) {
+            continue;
+        }
+        Data source = make_data(n);
+        bench_sequential(runner, source, n);
+        for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+            bench_parallel(runner, source, n, threads);
+        }
+        if ((max_threads & (max_threads - 1)) != 0) {
+            bench_parallel(runner, source, n, max_threads);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include "bench.h"
+
+#include "forward_list.h"
+#include "list.h"
+
+#include <cstdint>
+#include <optional>
+#include <random>
+
+// Скорость обхода List и ForwardList: сразу после заполнения, после
+// нескольких раундов удалений и вставок по всему списку (освобожденные узлы
+// переиспользуются аллокатором для элементов в других местах списка, и
+// соседние элементы оказываются далеко друг от друга в памяти) и после
+// relinearize(). Отдельно замеряется стоимость самой перестройки.
+
+namespace {
+
+const int churn_rounds = 4;
+
+// Раунд: удаление примерно половины элементов, затем вставка новых
+// в случайные места, пока размер не вернется к n
+void churn(List<uint32_t>& list, size_t n, std::mt19937& rng) {
+    for (auto it = list.begin(); it != list.end();) {
+        if (rng() & 1) {
+            it = list.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    while (list.size() < n) {
+        size_t deficit = n - list.size();
+        for (auto it = list.begin(); list.size() < n; ++it) {
+            if (rng() % (list.size() + 1) < deficit) {
+                list.insert(it, static_cast<uint32_t>(rng()));
+            }
+            if (it == list.end()) {
+                break;
+            }
+        }
+    }
+}
+
+void churn(ForwardList<uint32_t>& list, size_t n, std::mt19937& rng) {
+    for (auto prev = list.before_begin(); std::next(prev) != list.end();) {
+        if (rng() & 1) {
+            list.erase_after(prev);
+        } else {
+            ++prev;
+        }
+    }
+    while (list.size() < n) {
+        size_t deficit = n - list.size();
+        for (auto prev = list.before_begin(); prev != list.end() && list.size() < n; ++prev) {
+            if (rng() % (list.size() + 1) < deficit) {
+                prev = list.insert_after(prev, static_cast<uint32_t>(rng()));
+            }
+        }
+    }
+}
+
+enum class Layout { Fresh, Churned, Relinearized };
+
+template<typename C>
+std::optional<C> make_list(size_t n, Layout layout) {
+    std::optional<C> list(std::in_place);
+    fill_back(*list, n);
+    if (layout != Layout::Fresh) {
+        std::mt19937 rng(static_cast<unsigned>(n));
+        for (int round = 0; round < churn_rounds; ++round) {
+            churn(*list, n, rng);
+        }
+        if (layout == Layout::Relinearized) {
+            list->relinearize();
+        }
+    }
+    return list;
+}
+
+template<typename C>
+void bench_list(BenchRunner& runner, size_t n) {
+    using State = std::optional<C>;
+    const char* name = bench_name<C>::value;
+    struct Variant {
+        const char* operation;
+        Layout layout;
+    };
+    const Variant variants[] = {
+        {"iterate fresh", Layout::Fresh},
+        {"iterate churned", Layout::Churned},
+        {"iterate relinearized", Layout::Relinearized},
+    };
+    for (const Variant& variant : variants) {
+        runner.run(name, "u32", variant.operation, n, n,
+                   [n, &variant] { return make_list<C>(n, variant.layout); },
+                   [](State& s) {
+                       uint64_t sum = 0;
+                       for (uint32_t value : *s) {
+                           sum += value;
+                       }
+                       do_not_optimize(sum);
+                   });
+    }
+    runner.run(name, "u32", "relinearize", n, n,
+               [n] { return make_list<C>(n, Layout::Churned); },
+               [](State& s) {
+                   s->relinearize();
+                   do_not_optimize(*s);
+               });
+}
+
+} // namespace
+
+BENCH_SUITE(relinearize) {
+    for (size_t n : runner.sizes()) {
+        // Старые и новые узлы List одновременно во время перестройки
+        if (!runner.fits(n * 32 * 2)) {
+            continue;
+        }
+        bench_list<List<uint32_t>>(runner, n);
+        bench_list<ForwardList<uint32_t>>(runner, n);
+    }
+}
@@ -0,0 +1,114 @@
+#include "bench.h"
+
+#include "aligned_allocator.h"
+#include "simd.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+// Векторные ядра simd.h против цикла по Vector::operator[] (с проверкой
+// границ) на каждом наборе инструкций, доступном процессору. Данные
+// выровнены по 64 байтам (AlignedVector).
+
+namespace {
+
+template<typename T>
+void bench_loops(BenchRunner& runner, const AlignedVector<T>& a, const AlignedVector<T>& b, size_t n) {
+    const char* element = bench_name<T>::value;
+    runner.run("Vector loop", element, "sum", n, n,
+               [] { return simd::sum_t<T>(0); },
+               [&](simd::sum_t<T>& total) {
+                   for (size_t i = 0; i < a.size(); ++i) {
+                       total += a[i];
+                   }
+               });
+    runner.run("Vector loop", element, "dot", n, n,
+               [] { return simd::sum_t<T>(0); },
+               [&](simd::sum_t<T>& total) {
+                   for (size_t i = 0; i < a.size(); ++i) {
+                       total += static_cast<simd::sum_t<T>>(a[i]) * b[i];
+                   }
+               });
+    runner.run("Vector loop", element, "minmax", n, n,
+               [] { return std::pair<T, T>(); },
+               [&](std::pair<T, T>& bounds) {
+                   bounds = {a[0], a[0]};
+                   for (size_t i = 1; i < a.size(); ++i) {
+                       if (a[i] < bounds.first) {
+                           bounds.first = a[i];
+                       }
+                       if (bounds.second < a[i]) {
+                           bounds.second = a[i];
+                       }
+                   }
+               });
+    runner.run("Vector loop", element, "count", n, n,
+               [] { return size_t(0); },
+               [&](size_t& count) {
+                   for (size_t i = 0; i < a.size(); ++i) {
+                       count += a[i] == T(7);
+                   }
+               });
+    runner.run("Vector loop", element, "add", n, n,
+               [&] { return AlignedVector<T>(n); },
+               [&](AlignedVector<T>& out) {
+                   for (size_t i = 0; i < a.size(); ++i) {
+                       out[i] = a[i] + b[i];
+                   }
+               });
+}
+
+template<typename T>
+void bench_kernels(BenchRunner& runner, const AlignedVector<T>& a, const AlignedVector<T>& b, size_t n, simd::Isa isa) {
+    const char* element = bench_name<T>::value;
+    std::string container = std::string("simd ") + simd::isa_name(isa);
+    simd::set_isa(isa);
+    runner.run(container, element, "sum", n, n,
+               [] { return simd::sum_t<T>(0); },
+               [&](simd::sum_t<T>& total) { total = simd::sum(a); });
+    runner.run(container, element, "dot", n, n,
+               [] { return simd::sum_t<T>(0); },
+               [&](simd::sum_t<T>& total) { total = simd::dot(a, b); });
+    runner.run(container, element, "minmax", n, n,
+               [] { return std::pair<T, T>(); },
+               [&](std::pair<T, T>& bounds) { bounds = simd::minmax(a); });
+    runner.run(container, element, "count", n, n,
+               [] { return size_t(0); },
+               [&](size_t& count) { count = simd::count(a, T(7)); });
+    runner.run(container, element, "add", n, n,
+               [&] { return AlignedVector<T>(n); },
+               [&](AlignedVector<T>& out) { simd::add(a, b, out); });
+    simd::set_isa(simd::detected_isa());
+}
+
+template<typename T>
+void bench_type(BenchRunner& runner, size_t n) {
+    AlignedVector<T> a;
+    AlignedVector<T> b;
+    a.reserve(n);
+    b.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        a.push_back(static_cast<T>(i % 1000));
+        b.push_back(static_cast<T>(i % 7));
+    }
+    bench_loops(runner, a, b, n);
+    for (simd::Isa isa : {simd::Isa::Sse2, simd::Isa::Avx2, simd::Isa::Avx512}) {
+        if (isa <= simd::detected_isa()) {
+            bench_kernels(runner, a, b, n, isa);
+        }
+    }
+}
+
+} // namespace
+
+BENCH_SUITE(simd) {
+    for (size_t n : runner.sizes()) {
+        if (n < 1000 || !runner.fits(n * 3 * sizeof(double))) {
+            continue;
+        }
+        bench_type<int>(runner, n);
+        bench_type<float>(runner, n);
+        bench_type<double>(runner, n);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+#include "vector.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+// Аллокатор, выравнивающий каждый буфер по границе Alignment байт
+// (по умолчанию 64 - строка кэша и ширина регистра AVX-512). Векторные
+// ядра из simd.h используют на таких буферах выровненные загрузки, а
+// загрузка ни одного регистра не пересекает границу строки кэша.
+template<typename T, size_t Alignment = 64>
+class AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Выравнивание должно быть степенью двойки");
+
+    // Не меньше собственного выравнивания типа
+    static constexpr size_t alignment = Alignment < alignof(T) ? alignof(T) : Alignment;
+
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    // Параметр Alignment не выводится из T, поэтому rebind задается явно
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+    }
+
+    void deallocate(T* p, size_t) noexcept {
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return false;
+    }
+};
+
+// Вектор с буфером, выровненным по 64 байтам, для векторных ядер simd.h
+template<typename T, typename Stats = NoStats>
+using AlignedVector = Vector<T, AlignedAllocator<T>, Stats>;
+
+#endif
@@ -0,0 +1,727 @@
+#ifndef COMPACT_LIST_H
+#define COMPACT_LIST_H
+
+#include "vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Двунаправленный список, узлы которого лежат в одном растущем массиве
+// слотов и связаны 32-битными индексами вместо указателей. Узел List<int>
+// на 64-битной платформе занимает 24 байта и выделяется отдельно; слот
+// CompactList<int> - 12 байт в общем массиве. Освобожденные слоты
+// собираются в цепочку и переиспользуются следующими вставками.
+//
+// Итераторы хранят индекс слота, поэтому рост массива их не портит: они
+// становятся недействительными только при удалении своего элемента, а также
+// после compact() и shrink_to_fit(), которые перенумеровывают слоты в
+// порядке списка, чтобы проход по списку снова шел по памяти подряд.
+//
+// Stats - политика статистики (NoStats или ContainerStats, см. container_stats.h)
+template<typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats>
+class CompactList : private Stats {
+private:
+    // Индекс "нет слота": позиция end() и конец цепочки свободных слотов.
+    // Список замкнут в кольцо через npos: head_ - следующий за npos, tail_ - предыдущий.
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    struct Slot {
+        uint32_t prev;  // Индекс предыдущего слота списка
+        uint32_t next;  // Индекс следующего слота списка (у свободного слота - следующего свободного)
+        alignas(T) unsigned char storage[sizeof(T)];  // Место под элемент
+
+        T* raw() {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        T& value() {
+            return *std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using SlotAllocator = typename AllocTraits::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    Slot* slots_;        // Массив слотов
+    uint32_t capacity_;  // Количество слотов в массиве
+    uint32_t used_;      // Слоты [0, used_) уже выдавались; остальные ни разу не использованы
+    uint32_t free_;      // Первый освобожденный слот (npos - свободных нет)
+    uint32_t head_;      // Первый элемент списка (npos - список пуст)
+    uint32_t tail_;      // Последний элемент списка (npos - список пуст)
+    uint32_t size_;      // Количество элементов в списке
+    Allocator alloc;     // Аллокатор элементов (для слотов - его rebind)
+
+    static constexpr bool relocatable = is_trivially_relocatable<T>::value;
+
+    Slot* allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        SlotAllocator slot_alloc(alloc);
+        Slot* p = SlotTraits::allocate(slot_alloc, n);
+        Stats::on_allocate(n * sizeof(Slot));
+        return p;
+    }
+
+    void deallocate(Slot* p, size_t n) {
+        if (p) {
+            SlotAllocator slot_alloc(alloc);
+            SlotTraits::deallocate(slot_alloc, p, n);
+            Stats::on_deallocate(n * sizeof(Slot));
+        }
+    }
+
+    template<typename... Args>
+    void construct(Slot* slot, Args&&... args) {
+        AllocTraits::construct(alloc, slot->raw(), std::forward<Args>(args)...);
+        count_construction<T, Args&&...>(static_cast<Stats&>(*this));
+    }
+
+    void destroy(Slot* slot) {
+        AllocTraits::destroy(alloc, &slot->value());
+    }
+
+    template<typename U>
+    void assign_element(T& dst, U&& src) {
+        dst = std::forward<U>(src);
+        count_assignment<T, U&&>(static_cast<Stats&>(*this));
+    }
+
+    // Ссылки на связи с учетом кольца через npos
+    uint32_t& next_link(uint32_t index) {
+        return index == npos ? head_ : slots_[index].next;
+    }
+
+    uint32_t& prev_link(uint32_t index) {
+        return index == npos ? tail_ : slots_[index].prev;
+    }
+
+    size_t next_capacity() const {
+        if (capacity_ == npos) {
+            throw std::length_error("Превышена максимальная емкость CompactList");
+        }
+        size_t grown = DoublingGrowth::next_capacity(capacity_, size_t(capacity_) + 1, sizeof(Slot));
+        return grown < npos ? grown : npos;
+    }
+
+    // Перенос всех элементов в массив dst с сохранением индексов слотов
+    // (после вызова элементы старого массива считаются уничтоженными)
+    void move_slots(Slot* dst) {
+        if constexpr (relocatable) {
+            if (used_ != 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(slots_), used_ * sizeof(Slot));
+                Stats::on_relocate(size_);
+            }
+        } else {
+            for (uint32_t i = 0; i < used_; ++i) {
+                dst[i].prev = slots_[i].prev;
+                dst[i].next = slots_[i].next;
+            }
+            uint32_t current = head_;
+            try {
+                for (; current != npos; current = slots_[current].next) {
+                    construct(dst + current, std::move_if_noexcept(slots_[current].value()));
+                }
+            } catch (...) {
+                for (uint32_t i = head_; i != current; i = slots_[i].next) {
+                    destroy(dst + i);
+                }
+                throw;
+            }
+            for (uint32_t i = head_; i != npos; i = slots_[i].next) {
+                destroy(slots_ + i);
+            }
+        }
+    }
+
+    // Создание элемента в свободном слоте. Возвращает индекс слота (еще не связанного).
+    // Если массив растет, новый элемент создается в новом массиве до переноса
+    // старых, поэтому аргументы могут ссылаться на элементы самого списка.
+    template<typename... Args>
+    uint32_t create_slot(Args&&... args) {
+        if (free_ != npos) {
+            uint32_t index = free_;
+            construct(slots_ + index, std::forward<Args>(args)...);
+            free_ = slots_[index].next;
+            return index;
+        }
+        if (used_ == capacity_) {
+            size_t new_capacity = next_capacity();
+            Slot* new_slots = allocate(new_capacity);
+            Stats::on_reallocate();
+            try {
+                construct(new_slots + used_, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_slots, new_capacity);
+                throw;
+            }
+            try {
+                move_slots(new_slots);
+            } catch (...) {
+                destroy(new_slots + used_);
+                deallocate(new_slots, new_capacity);
+                throw;
+            }
+            deallocate(slots_, capacity_);
+            slots_ = new_slots;
+            capacity_ = static_cast<uint32_t>(new_capacity);
+        } else {
+            construct(slots_ + used_, std::forward<Args>(args)...);
+        }
+        return used_++;
+    }
+
+    // Вставка слота index перед позицией pos за O(1)
+    void link_before(uint32_t pos, uint32_t index) {
+        uint32_t prev = prev_link(pos);
+        slots_[index].prev = prev;
+        slots_[index].next = pos;
+        next_link(prev) = index;
+        prev_link(pos) = index;
+        ++size_;
+    }
+
+    // Удаление элемента за O(1): слот уходит в цепочку свободных. Возвращает следующий слот.
+    uint32_t erase_slot(uint32_t index) {
+        Slot& slot = slots_[index];
+        uint32_t next = slot.next;
+        next_link(slot.prev) = next;
+        prev_link(next) = slot.prev;
+        destroy(&slot);
+        --size_;
+        if (size_ == 0) {
+            // Список опустел: весь массив снова свободен и выдается с начала
+            free_ = npos;
+            used_ = 0;
+        } else {
+            slot.next = free_;
+            free_ = index;
+        }
+        return next;
+    }
+
+    // Слот элемента с индексом pos (для pos == size_ - npos).
+    // Проход начинается с ближайшего конца списка.
+    uint32_t slot_at(size_t pos) const {
+        if (pos == size_) {
+            return npos;
+        }
+        uint32_t current;
+        if (pos < size_ - pos) {
+            current = head_;
+            for (size_t i = 0; i < pos; ++i) {
+                current = slots_[current].next;
+            }
+            const_cast<CompactList*>(this)->Stats::on_node_hops(pos);
+        } else {
+            current = tail_;
+            for (size_t i = size_ - 1; i > pos; --i) {
+                current = slots_[current].prev;
+            }
+            const_cast<CompactList*>(this)->Stats::on_node_hops(size_ - 1 - pos);
+        }
+        return current;
+    }
+
+    // Перестройка в новый массив на new_capacity слотов (не меньше size_):
+    // элементы переносятся в порядке списка в слоты 0, 1, 2, ...
+    void rebuild(size_t new_capacity) {
+        Slot* new_slots = allocate(new_capacity);
+        Stats::on_reallocate();
+        uint32_t position = 0;
+        uint32_t current = head_;
+        if constexpr (relocatable) {
+            for (; current != npos; current = slots_[current].next, ++position) {
+                std::memcpy(static_cast<void*>(new_slots[position].storage),
+                            static_cast<const void*>(slots_[current].storage), sizeof(T));
+            }
+            Stats::on_relocate(size_);
+        } else {
+            try {
+                for (; current != npos; current = slots_[current].next, ++position) {
+                    construct(new_slots + position, std::move_if_noexcept(slots_[current].value()));
+                }
+            } catch (...) {
+                for (uint32_t i = 0; i < position; ++i) {
+                    destroy(new_slots + i);
+                }
+                deallocate(new_slots, new_capacity);
+                throw;
+            }
+            for (uint32_t i = head_; i != npos; i = slots_[i].next) {
+                destroy(slots_ + i);
+            }
+        }
+        for (uint32_t i = 0; i < size_; ++i) {
+            new_slots[i].prev = i == 0 ? npos : i - 1;
+            new_slots[i].next = i + 1 == size_ ? npos : i + 1;
+        }
+        deallocate(slots_, capacity_);
+        slots_ = new_slots;
+        capacity_ = static_cast<uint32_t>(new_capacity);
+        used_ = size_;
+        free_ = npos;
+        head_ = size_ == 0 ? npos : 0;
+        tail_ = size_ == 0 ? npos : size_ - 1;
+    }
+
+    // Уничтожение элементов и освобождение массива
+    void release_storage() {
+        clear();
+        deallocate(slots_, capacity_);
+        slots_ = nullptr;
+        capacity_ = 0;
+    }
+
+    // Перехват массива другого списка (текущий список должен не иметь массива)
+    void take_storage(CompactList& other) noexcept {
+        slots_ = other.slots_;
+        capacity_ = other.capacity_;
+        used_ = other.used_;
+        free_ = other.free_;
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+
+        other.slots_ = nullptr;
+        other.capacity_ = other.used_ = other.size_ = 0;
+        other.free_ = other.head_ = other.tail_ = npos;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    CompactList()
+        : slots_(nullptr), capacity_(0), used_(0), free_(npos), head_(npos), tail_(npos), size_(0), alloc() {}
+
+    explicit CompactList(const Allocator& allocator)
+        : slots_(nullptr), capacity_(0), used_(0), free_(npos), head_(npos), tail_(npos), size_(0),
+          alloc(allocator) {}
+
+    // Копирующий конструктор
+    CompactList(const CompactList& other)
+        : CompactList(other, AllocTraits::select_on_container_copy_construction(other.alloc)) {}
+
+    // Копирующий конструктор с заданным аллокатором: копия сразу лежит в порядке списка
+    CompactList(const CompactList& other, const Allocator& allocator) : CompactList(allocator) {
+        reserve(other.size_);
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+
+    // Перемещающий конструктор
+    CompactList(CompactList&& other) noexcept
+        : slots_(nullptr), capacity_(0), used_(0), free_(npos), head_(npos), tail_(npos), size_(0),
+          alloc(std::move(other.alloc)) {
+        take_storage(other);
+    }
+
+    // Копирующий оператор присваивания: массив слотов и живые элементы переиспользуются
+    CompactList& operator=(const CompactList& other) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                if (!(alloc == other.alloc)) {
+                    release_storage();
+                }
+                alloc = other.alloc;
+            }
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // Перемещающий оператор присваивания
+    CompactList& operator=(CompactList&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                                         AllocTraits::is_always_equal::value) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                release_storage();
+                alloc = std::move(other.alloc);
+                take_storage(other);
+            } else if (alloc == other.alloc) {
+                release_storage();
+                take_storage(other);
+            } else {
+                // Массив чужого аллокатора перехватить нельзя: перемещаем элементы
+                clear();
+                reserve(other.size_);
+                for (T& value : other) {
+                    push_back(std::move(value));
+                }
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~CompactList() {
+        release_storage();
+    }
+
+    // Очистка списка. Массив слотов сохраняется; для тривиально
+    // уничтожаемых типов очистка - O(1).
+    void clear() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (uint32_t i = head_; i != npos; i = slots_[i].next) {
+                destroy(slots_ + i);
+            }
+        }
+        used_ = size_ = 0;
+        free_ = head_ = tail_ = npos;
+    }
+
+    // Замена содержимого элементами диапазона [first, last): элементам в
+    // порядке списка присваиваются новые значения, недостающие создаются в
+    // свободных слотах, лишние уходят в цепочку свободных. Массив растет,
+    // только если слотов не хватает. Диапазон не должен указывать на
+    // элементы самого списка.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        uint32_t current = head_;
+        for (; current != npos && first != last; current = slots_[current].next, ++first) {
+            assign_element(slots_[current].value(), *first);
+        }
+        while (current != npos) {
+            current = erase_slot(current);
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        uint32_t index = create_slot(std::forward<Args>(args)...);
+        link_before(npos, index);
+        return slots_[index].value();
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        uint32_t index = create_slot(std::forward<Args>(args)...);
+        link_before(head_, index);
+        return slots_[index].value();
+    }
+
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return slots_[head_].value();
+    }
+
+    const T& front() const {
+        return const_cast<CompactList&>(*this).front();
+    }
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return slots_[tail_].value();
+    }
+
+    const T& back() const {
+        return const_cast<CompactList&>(*this).back();
+    }
+
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        erase_slot(tail_);
+    }
+
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        erase_slot(head_);
+    }
+
+    // Вставка элемента в произвольную позицию (поиск позиции - O(n))
+    void insert(size_t pos, const T& value) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        uint32_t next = slot_at(pos);
+        link_before(next, create_slot(value));
+    }
+
+    void insert(size_t pos, T&& value) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        uint32_t next = slot_at(pos);
+        link_before(next, create_slot(std::move(value)));
+    }
+
+    // Удаление элемента по позиции (поиск позиции - O(n))
+    void erase(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        erase_slot(slot_at(pos));
+    }
+
+    // Доступ к элементу по индексу за O(n)
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return slots_[slot_at(index)].value();
+    }
+
+    const T& operator[](size_t index) const {
+        return const_cast<CompactList&>(*this)[index];
+    }
+
+    T& at(size_t index) {
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        return (*this)[index];
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    // Резервирование слотов. Индексы слотов сохраняются, итераторы остаются действительными.
+    void reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        if (new_capacity > npos) {
+            throw std::length_error("Превышена максимальная емкость CompactList");
+        }
+        Slot* new_slots = allocate(new_capacity);
+        Stats::on_reallocate();
+        try {
+            move_slots(new_slots);
+        } catch (...) {
+            deallocate(new_slots, new_capacity);
+            throw;
+        }
+        deallocate(slots_, capacity_);
+        slots_ = new_slots;
+        capacity_ = static_cast<uint32_t>(new_capacity);
+    }
+
+    // Перенумерация слотов в порядке списка: после нее проход по списку идет
+    // по массиву подряд, а свободные слоты собраны в конце. Итераторы
+    // становятся недействительными. Уже упорядоченный список не трогается.
+    void compact() {
+        if (used_ == size_) {
+            uint32_t expected = 0;
+            uint32_t current = head_;
+            while (current == expected) {
+                current = slots_[current].next;
+                ++expected;
+            }
+            if (current == npos && expected == size_) {
+                return;
+            }
+        }
+        rebuild(capacity_);
+    }
+
+    // Перенумерация слотов (как compact()) с освобождением лишней емкости
+    void shrink_to_fit() {
+        if (capacity_ != size_) {
+            rebuild(size_);
+        } else {
+            compact();
+        }
+    }
+
+    // Память, занимаемая списком: сам объект и массив слотов.
+    // Память, которой владеют сами элементы (например, строки), не учитывается.
+    size_t memory_footprint() const {
+        return sizeof(*this) + size_t(capacity_) * sizeof(Slot);
+    }
+
+    // Счетчики политики статистики (для NoStats - пустой объект)
+    const Stats& stats() const {
+        return *this;
+    }
+
+    Stats& stats() {
+        return *this;
+    }
+
+    Allocator get_allocator() const {
+        return alloc;
+    }
+
+    // Двунаправленный итератор: список и индекс слота, поэтому переезд
+    // массива слотов при росте итератор не портит;
+    // const_iterator дает доступ к элементам только на чтение
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class CompactList;
+        template<bool>
+        friend class basic_iterator;
+
+        using ListPointer = std::conditional_t<Const, const CompactList*, CompactList*>;
+
+        ListPointer list;  // Список, по которому идет итератор
+        uint32_t current;  // Индекс слота текущего элемента (npos - end())
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : list(nullptr), current(npos) {}
+
+        basic_iterator(ListPointer owner, uint32_t index) : list(owner), current(index) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : list(other.list), current(other.current) {}
+
+        reference operator*() const {
+            return list->slots_[current].value();
+        }
+
+        pointer operator->() const {
+            return &list->slots_[current].value();
+        }
+
+        basic_iterator& operator++() {
+            current = list->slots_[current].next;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        // --end() указывает на последний элемент
+        basic_iterator& operator--() {
+            current = current == npos ? list->tail_ : list->slots_[current].prev;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.current == b.current;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.current != b.current;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() {
+        return iterator(this, head_);
+    }
+
+    iterator end() {
+        return iterator(this, npos);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, head_);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, npos);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // Конструирование элемента на месте перед pos за O(1).
+    // Возвращает итератор на вставленный элемент.
+    template<typename... Args>
+    iterator emplace(iterator pos, Args&&... args) {
+        uint32_t index = create_slot(std::forward<Args>(args)...);
+        link_before(pos.current, index);
+        return iterator(this, index);
+    }
+
+    iterator insert(iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    // Удаление элемента по итератору за O(1). Возвращает итератор на следующий элемент.
+    iterator erase(iterator pos) {
+        if (pos.current == npos) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        return iterator(this, erase_slot(pos.current));
+    }
+
+    // Удаление элементов в диапазоне [first, last). Возвращает last.
+    iterator erase(iterator first, iterator last) {
+        while (first != last) {
+            first = erase(first);
+        }
+        return last;
+    }
+};
+
+#endif
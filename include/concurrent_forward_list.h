@@ -0,0 +1,209 @@
+#ifndef CONCURRENT_FORWARD_LIST_H
+#define CONCURRENT_FORWARD_LIST_H
+
+#include "forward_list.h"
+#include "hazard_pointer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+// Однонаправленный список для нескольких потоков (стек Трайбера):
+// push_front, pop_front, push_front_batch и take_all без блокировок.
+// Вставка и извлечение - один CAS на голове списка; узлы, извлеченные
+// из списка, освобождаются через указатели опасности (hazard_pointer.h).
+//
+// Каждый узел попадает в список ровно один раз: take_all() переносит
+// значения в обычный ForwardList, а не возвращает сами узлы. Поэтому
+// адрес, увиденный в голове, не может вернуться туда с другим next (ABA).
+// Узлы выделяются через new: освобождение может произойти в другом потоке
+// и уже после уничтожения самого списка.
+template<typename T>
+class ConcurrentForwardList {
+private:
+    struct Node {
+        Node* next;  // Указатель на следующий узел
+        T data;      // Данные, хранящиеся в узле
+
+        template<typename... Args>
+        Node(std::in_place_t, Args&&... args) : next(nullptr), data(std::forward<Args>(args)...) {}
+    };
+
+    std::atomic<Node*> head;  // Первый узел списка
+
+    // Вставка готовой цепочки [first, last] в начало одним CAS
+    void link_front(Node* first, Node* last) {
+        last->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(last->next, first, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+public:
+    // Цепочка узлов, собранная одним потоком без синхронизации, для вставки
+    // в список одной операцией push_front_batch
+    class Chain {
+    private:
+        friend class ConcurrentForwardList;
+
+        Node* first;  // Первый узел цепочки
+        Node* last;   // Последний узел цепочки
+        size_t size_; // Количество узлов
+
+    public:
+        Chain() : first(nullptr), last(nullptr), size_(0) {}
+
+        Chain(const Chain&) = delete;
+        Chain& operator=(const Chain&) = delete;
+
+        Chain(Chain&& other) noexcept : first(other.first), last(other.last), size_(other.size_) {
+            other.first = nullptr;
+            other.last = nullptr;
+            other.size_ = 0;
+        }
+
+        ~Chain() {
+            while (first) {
+                Node* next = first->next;
+                delete first;
+                first = next;
+            }
+        }
+
+        // Добавление элемента в конец цепочки
+        template<typename... Args>
+        void emplace_back(Args&&... args) {
+            Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+            if (last) {
+                last->next = node;
+            } else {
+                first = node;
+            }
+            last = node;
+            ++size_;
+        }
+
+        void push_back(const T& value) {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value) {
+            emplace_back(std::move(value));
+        }
+
+        size_t size() const {
+            return size_;
+        }
+
+        bool empty() const {
+            return size_ == 0;
+        }
+    };
+
+    ConcurrentForwardList() : head(nullptr) {}
+
+    ConcurrentForwardList(const ConcurrentForwardList&) = delete;
+    ConcurrentForwardList& operator=(const ConcurrentForwardList&) = delete;
+
+    // Уничтожение допустимо только когда другие потоки уже не обращаются к списку
+    ~ConcurrentForwardList() {
+        Node* node = head.load(std::memory_order_acquire);
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    // Конструирование элемента на месте в начале списка
+    template<typename... Args>
+    void emplace_front(Args&&... args) {
+        Node* node = new Node(std::in_place, std::forward<Args>(args)...);
+        link_front(node, node);
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    // Вставка всей цепочки в начало одним CAS; порядок элементов цепочки
+    // сохраняется, после вызова цепочка пуста
+    void push_front_batch(Chain&& chain) {
+        if (chain.empty()) {
+            return;
+        }
+        link_front(chain.first, chain.last);
+        chain.first = nullptr;
+        chain.last = nullptr;
+        chain.size_ = 0;
+    }
+
+    // Вставка элементов диапазона [first, last) в начало одной операцией
+    template<typename InputIt>
+    void push_front_batch(InputIt first, InputIt last) {
+        Chain chain;
+        for (; first != last; ++first) {
+            chain.emplace_back(*first);
+        }
+        push_front_batch(std::move(chain));
+    }
+
+    // Извлечение первого элемента; пустой optional, если список пуст
+    std::optional<T> pop_front() {
+        Node* node;
+        while (true) {
+            node = HazardPointers::protect(head);
+            if (!node) {
+                HazardPointers::clear();
+                return std::nullopt;
+            }
+            // Узел защищен, поэтому чтение next безопасно, даже если
+            // другой поток уже извлек его из списка
+            Node* next = node->next;
+            if (head.compare_exchange_strong(node, next, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        HazardPointers::clear();
+
+        // Узел принадлежит только этому потоку; другие могут лишь читать его next
+        std::optional<T> value(std::move(node->data));
+        HazardPointers::retire(node);
+        return value;
+    }
+
+    // Извлечение всех элементов одной операцией (в порядке от головы к хвосту).
+    // Если перенос значения бросит исключение, оставшиеся элементы теряются:
+    // вернуть узлы в список нельзя, не нарушив защиту от ABA.
+    ForwardList<T> take_all() {
+        Node* node = head.exchange(nullptr, std::memory_order_acquire);
+        ForwardList<T> out;
+        try {
+            while (node) {
+                out.push_back(std::move(node->data));
+                Node* next = node->next;
+                HazardPointers::retire(node);
+                node = next;
+            }
+        } catch (...) {
+            while (node) {
+                Node* next = node->next;
+                HazardPointers::retire(node);
+                node = next;
+            }
+            throw;
+        }
+        return out;
+    }
+
+    // Пуст ли список в момент вызова
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef CONCURRENT_VECTOR_H
+#define CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Вектор только для добавления, к которому могут одновременно дописывать
+// несколько потоков. Элементы хранятся в сегментах, размеры которых растут
+// вдвое (8, 16, 32, ...), и никогда не переносятся: ссылки и указатели на
+// элементы остаются действительными до уничтожения вектора.
+//
+// push_back и grow_by резервируют индексы одним fetch_add, конструируют
+// элементы и публикуют их флагом готовности. Таблица сегментов имеет
+// фиксированный размер и не перевыделяется, поэтому operator[] - это
+// несколько арифметических операций и два чтения без ожидания (wait-free).
+template<typename T>
+class ConcurrentVector {
+private:
+    static constexpr size_t first_segment_bits = 3;
+    static constexpr size_t first_segment_size = size_t(1) << first_segment_bits;
+    static constexpr size_t max_segments = sizeof(size_t) * 8 - first_segment_bits;
+
+    // Сегмент: элементы, за ними - флаги готовности
+    struct Segment {
+        T* items;
+        std::atomic<bool>* ready;
+    };
+
+    std::atomic<T*> segments[max_segments];  // Начала сегментов (nullptr - еще не выделен)
+    std::atomic<size_t> reserved;            // Количество выданных индексов
+
+    static size_t floor_log2(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return sizeof(unsigned long long) * 8 - 1 - static_cast<size_t>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return index;
+#else
+        size_t result = 0;
+        while (value >>= 1) {
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+    static size_t segment_size(size_t segment) {
+        return first_segment_size << segment;
+    }
+
+    // Номер сегмента и смещение в нем для индекса index: сегмент k
+    // содержит индексы [8 * (2^k - 1), 8 * (2^(k+1) - 1))
+    static size_t segment_of(size_t index, size_t& offset) {
+        size_t shifted = index + first_segment_size;
+        size_t bit = floor_log2(shifted);
+        offset = shifted - (size_t(1) << bit);
+        return bit - first_segment_bits;
+    }
+
+    static size_t segment_bytes(size_t segment) {
+        return segment_size(segment) * (sizeof(T) + sizeof(std::atomic<bool>));
+    }
+
+    static Segment view(T* items, size_t segment) {
+        return Segment{items, reinterpret_cast<std::atomic<bool>*>(items + segment_size(segment))};
+    }
+
+    // Сегмент с номером segment; выделяется первым потоком, которому он
+    // понадобился. Проигравший гонку поток освобождает свою копию.
+    T* get_segment(size_t segment) {
+        T* items = segments[segment].load(std::memory_order_acquire);
+        if (items) {
+            return items;
+        }
+        size_t size = segment_size(segment);
+        T* fresh = static_cast<T*>(::operator new(segment_bytes(segment), std::align_val_t(alignof(T))));
+        std::atomic<bool>* ready = view(fresh, segment).ready;
+        for (size_t i = 0; i < size; ++i) {
+            ::new (static_cast<void*>(ready + i)) std::atomic<bool>(false);
+        }
+        if (segments[segment].compare_exchange_strong(items, fresh, std::memory_order_acq_rel,
+                                                      std::memory_order_acquire)) {
+            return fresh;
+        }
+        ::operator delete(fresh, std::align_val_t(alignof(T)));
+        return items;
+    }
+
+    // Конструирование элемента с зарезервированным индексом и его публикация
+    template<typename... Args>
+    void construct_at(size_t index, Args&&... args) {
+        size_t offset;
+        size_t segment = segment_of(index, offset);
+        Segment s = view(get_segment(segment), segment);
+        ::new (static_cast<void*>(s.items + offset)) T(std::forward<Args>(args)...);
+        s.ready[offset].store(true, std::memory_order_release);
+    }
+
+    // Указатель на опубликованный элемент или nullptr
+    T* published(size_t index) const {
+        size_t offset;
+        size_t segment = segment_of(index, offset);
+        T* items = segments[segment].load(std::memory_order_acquire);
+        if (!items || !view(items, segment).ready[offset].load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return items + offset;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+
+    ConcurrentVector() : reserved(0) {
+        for (std::atomic<T*>& segment : segments) {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    // Уничтожение допустимо только когда другие потоки уже не обращаются к вектору
+    ~ConcurrentVector() {
+        for (size_t segment = 0; segment < max_segments; ++segment) {
+            T* items = segments[segment].load(std::memory_order_acquire);
+            if (!items) {
+                continue;
+            }
+            Segment s = view(items, segment);
+            for (size_t i = 0; i < segment_size(segment); ++i) {
+                if (s.ready[i].load(std::memory_order_relaxed)) {
+                    s.items[i].~T();
+                }
+            }
+            ::operator delete(items, std::align_val_t(alignof(T)));
+        }
+    }
+
+    // Конструирование элемента на месте в конце; возвращает его индекс
+    template<typename... Args>
+    size_t emplace_back(Args&&... args) {
+        size_t index = reserved.fetch_add(1, std::memory_order_relaxed);
+        construct_at(index, std::forward<Args>(args)...);
+        return index;
+    }
+
+    size_t push_back(const T& value) {
+        return emplace_back(value);
+    }
+
+    size_t push_back(T&& value) {
+        return emplace_back(std::move(value));
+    }
+
+    // Добавление count копий value; возвращает индекс первого из них.
+    // Индексы [first, first + count) принадлежат только этому вызову.
+    size_t grow_by(size_t count, const T& value) {
+        size_t first = reserved.fetch_add(count, std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            construct_at(first + i, value);
+        }
+        return first;
+    }
+
+    // Добавление count элементов, инициализированных значением по умолчанию
+    size_t grow_by(size_t count) {
+        size_t first = reserved.fetch_add(count, std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            construct_at(first + i);
+        }
+        return first;
+    }
+
+    // Доступ к опубликованному элементу без ожидания. Элемент, индекс
+    // которого уже выдан, но который еще конструируется, недоступен.
+    T& operator[](size_t index) {
+        return const_cast<T&>(static_cast<const ConcurrentVector&>(*this)[index]);
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        T* item = published(index);
+        if (!item) {
+            throw std::out_of_range("Элемент еще не опубликован");
+        }
+        return *item;
+    }
+
+    // Опубликован ли элемент с индексом index
+    bool is_published(size_t index) const {
+        return index < size() && published(index) != nullptr;
+    }
+
+    // Количество выданных индексов (часть элементов может еще конструироваться)
+    size_t size() const {
+        return reserved.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // Итератор по опубликованным элементам с индексами меньше размера
+    // на момент вызова begin(); неготовые элементы пропускаются. Обход
+    // можно вести одновременно с добавлением элементов другими потоками.
+    class iterator {
+    private:
+        ConcurrentVector* vec;  // Вектор, по которому идет обход
+        size_t index;           // Индекс текущего элемента
+        size_t end;             // Граница обхода
+
+        void skip_unpublished() {
+            while (index < end && !vec->published(index)) {
+                ++index;
+            }
+        }
+
+        bool done() const {
+            return index >= end;
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() : vec(nullptr), index(0), end(0) {}
+
+        iterator(ConcurrentVector* v, size_t i, size_t e) : vec(v), index(i), end(e) {
+            skip_unpublished();
+        }
+
+        T& operator*() const {
+            return *vec->published(index);
+        }
+
+        T* operator->() const {
+            return vec->published(index);
+        }
+
+        iterator& operator++() {
+            ++index;
+            skip_unpublished();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        // Номер элемента, на который указывает итератор
+        size_t position() const {
+            return index;
+        }
+
+        // Любой пройденный до конца итератор равен end(), даже если
+        // за время обхода вектор вырос
+        bool operator==(const iterator& other) const {
+            if (done() || other.done()) {
+                return done() == other.done();
+            }
+            return index == other.index;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    iterator begin() {
+        size_t end = size();
+        return iterator(this, 0, end);
+    }
+
+    iterator end() {
+        size_t end = size();
+        return iterator(this, end, end);
+    }
+};
+
+#endif
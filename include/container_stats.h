@@ -0,0 +1,138 @@
+#ifndef CONTAINER_STATS_H
+#define CONTAINER_STATS_H
+
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+#include <type_traits>
+
+// Политики статистики для Vector, List и ForwardList. Контейнер наследуется
+// от политики, поэтому пустая NoStats не занимает места, а ее пустые методы
+// полностью убираются компилятором.
+
+// Статистика отключена (по умолчанию)
+struct NoStats {
+    static constexpr bool enabled = false;
+
+    void on_allocate(size_t) {}
+    void on_deallocate(size_t) {}
+    void on_copy_construct(size_t = 1) {}
+    void on_move_construct(size_t = 1) {}
+    void on_direct_construct(size_t = 1) {}
+    void on_copy_assign(size_t = 1) {}
+    void on_move_assign(size_t = 1) {}
+    void on_relocate(size_t) {}
+    void on_reallocate() {}
+    void on_node_hops(size_t) {}
+};
+
+// Счетчики выделений памяти и операций над элементами
+struct ContainerStats {
+    static constexpr bool enabled = true;
+
+    size_t allocations = 0;          // Обращений к аллокатору за памятью
+    size_t allocated_bytes = 0;      // Выделено байт
+    size_t deallocations = 0;        // Возвратов памяти аллокатору
+    size_t deallocated_bytes = 0;    // Освобождено байт
+    size_t copy_constructions = 0;   // Элементов создано копированием
+    size_t move_constructions = 0;   // Элементов создано перемещением
+    size_t direct_constructions = 0; // Элементов создано из других аргументов (emplace, resize)
+    size_t copy_assignments = 0;     // Копирующих присваиваний элементов
+    size_t move_assignments = 0;     // Перемещающих присваиваний элементов
+    size_t relocations = 0;          // Элементов, перенесенных побайтово (memcpy/memmove)
+    size_t reallocations = 0;        // Перевыделений буфера
+    size_t node_hops = 0;            // Переходов по узлам при поиске позиции по индексу
+
+    void on_allocate(size_t bytes) {
+        ++allocations;
+        allocated_bytes += bytes;
+    }
+
+    void on_deallocate(size_t bytes) {
+        ++deallocations;
+        deallocated_bytes += bytes;
+    }
+
+    void on_copy_construct(size_t count = 1) {
+        copy_constructions += count;
+    }
+
+    void on_move_construct(size_t count = 1) {
+        move_constructions += count;
+    }
+
+    void on_direct_construct(size_t count = 1) {
+        direct_constructions += count;
+    }
+
+    void on_copy_assign(size_t count = 1) {
+        copy_assignments += count;
+    }
+
+    void on_move_assign(size_t count = 1) {
+        move_assignments += count;
+    }
+
+    void on_relocate(size_t count) {
+        relocations += count;
+    }
+
+    void on_reallocate() {
+        ++reallocations;
+    }
+
+    void on_node_hops(size_t count) {
+        node_hops += count;
+    }
+
+    void reset() {
+        *this = ContainerStats();
+    }
+
+    // Печать отчета в одну строку на счетчик
+    void print(std::ostream& out) const {
+        out << "  выделений памяти: " << allocations << " (" << allocated_bytes << " байт)\n"
+            << "  освобождений: " << deallocations << " (" << deallocated_bytes << " байт)\n"
+            << "  созданий копированием / перемещением / на месте: " << copy_constructions << " / "
+            << move_constructions << " / " << direct_constructions << "\n"
+            << "  присваиваний копированием / перемещением: " << copy_assignments << " / " << move_assignments << "\n"
+            << "  побайтовых переносов элементов: " << relocations << "\n"
+            << "  перевыделений буфера: " << reallocations << "\n"
+            << "  переходов по узлам: " << node_hops << "\n";
+    }
+};
+
+// Учет создания элемента типа T из аргументов Args: одиночный аргумент типа T
+// считается копированием или перемещением, все остальное - созданием на месте
+template<typename T, typename... Args, typename Stats>
+void count_construction(Stats& stats) {
+    if constexpr (Stats::enabled) {
+        if constexpr (sizeof...(Args) == 1) {
+            using Arg = std::tuple_element_t<0, std::tuple<Args...>>;
+            if constexpr (std::is_same<std::decay_t<Arg>, T>::value) {
+                if constexpr (std::is_lvalue_reference<Arg>::value ||
+                              std::is_const<std::remove_reference_t<Arg>>::value) {
+                    stats.on_copy_construct();
+                } else {
+                    stats.on_move_construct();
+                }
+                return;
+            }
+        }
+        stats.on_direct_construct();
+    }
+}
+
+// То же для присваивания элементу типа T значения типа Arg
+template<typename T, typename Arg, typename Stats>
+void count_assignment(Stats& stats) {
+    if constexpr (Stats::enabled) {
+        if constexpr (std::is_lvalue_reference<Arg>::value || std::is_const<std::remove_reference_t<Arg>>::value) {
+            stats.on_copy_assign();
+        } else {
+            stats.on_move_assign();
+        }
+    }
+}
+
+#endif
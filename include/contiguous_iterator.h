@@ -0,0 +1,130 @@
+#ifndef CONTIGUOUS_ITERATOR_H
+#define CONTIGUOUS_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Итератор по непрерывному буферу элементов (Vector, SmallVector,
+// MappedVector) - обертка над указателем с полным набором операций
+// итератора произвольного доступа. С ним std::sort, std::lower_bound и
+// остальные алгоритмы выбирают те же быстрые пути, что и для указателей.
+//
+// T - тип элемента (const T для const_iterator); Container только
+// различает итераторы разных контейнеров, чтобы их нельзя было смешать.
+template<typename T, typename Container>
+class ContiguousIterator {
+private:
+    T* ptr;  // Указатель на текущий элемент
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus >= 202002L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    ContiguousIterator() noexcept : ptr(nullptr) {}
+
+    explicit ContiguousIterator(T* p) noexcept : ptr(p) {}
+
+    // Преобразование iterator -> const_iterator
+    template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+    ContiguousIterator(const ContiguousIterator<U, Container>& other) noexcept : ptr(other.base()) {}
+
+    // Указатель на текущий элемент
+    T* base() const noexcept {
+        return ptr;
+    }
+
+    reference operator*() const {
+        return *ptr;
+    }
+
+    pointer operator->() const {
+        return ptr;
+    }
+
+    reference operator[](difference_type n) const {
+        return ptr[n];
+    }
+
+    ContiguousIterator& operator++() {
+        ++ptr;
+        return *this;
+    }
+
+    ContiguousIterator operator++(int) {
+        ContiguousIterator temp = *this;
+        ++ptr;
+        return temp;
+    }
+
+    ContiguousIterator& operator--() {
+        --ptr;
+        return *this;
+    }
+
+    ContiguousIterator operator--(int) {
+        ContiguousIterator temp = *this;
+        --ptr;
+        return temp;
+    }
+
+    ContiguousIterator& operator+=(difference_type n) {
+        ptr += n;
+        return *this;
+    }
+
+    ContiguousIterator& operator-=(difference_type n) {
+        ptr -= n;
+        return *this;
+    }
+
+    friend ContiguousIterator operator+(ContiguousIterator it, difference_type n) {
+        return it += n;
+    }
+
+    friend ContiguousIterator operator+(difference_type n, ContiguousIterator it) {
+        return it += n;
+    }
+
+    friend ContiguousIterator operator-(ContiguousIterator it, difference_type n) {
+        return it -= n;
+    }
+
+    // Сравнения и разность определены как друзья без шаблона, поэтому
+    // iterator и const_iterator сравниваются через неявное преобразование
+    friend difference_type operator-(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr - b.ptr;
+    }
+
+    friend bool operator==(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr == b.ptr;
+    }
+
+    friend bool operator!=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr != b.ptr;
+    }
+
+    friend bool operator<(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr < b.ptr;
+    }
+
+    friend bool operator>(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr > b.ptr;
+    }
+
+    friend bool operator<=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr <= b.ptr;
+    }
+
+    friend bool operator>=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr >= b.ptr;
+    }
+};
+
+#endif
@@ -0,0 +1,740 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include "container_stats.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Число элементов в блоке Deque - степень двойки (индекс раскладывается на
+// номер блока и смещение сдвигом и маской): блок до 512 байт, но не меньше
+// 16 элементов. Возвращает логарифм числа элементов.
+template<typename T>
+constexpr size_t deque_block_shift() {
+    size_t shift = 4;
+    while ((size_t(2) << shift) * sizeof(T) <= 512) {
+        ++shift;
+    }
+    return shift;
+}
+
+// Двусторонняя очередь из блоков фиксированного размера и карты блоков
+// (массива указателей на блоки). Слоты всех блоков карты пронумерованы
+// подряд; элемент с индексом i лежит в слоте start_ + i, поэтому доступ по
+// индексу - сдвиг, маска и два обращения к памяти.
+//
+// Добавление и удаление с обоих концов - амортизированно O(1): элементы при
+// этом не переносятся, при нехватке места перестраивается только карта.
+// Ссылки на элементы остаются действительными при push_front/push_back,
+// итераторы - нет (они хранят указатель на карту). Вставка и удаление в
+// середине сдвигают элементы к ближайшему концу.
+//
+// Освободившиеся блоки остаются в карте и используются повторно (как емкость
+// у Vector); вернуть их аллокатору можно через shrink_to_fit().
+//
+// Stats - политика статистики (NoStats или ContainerStats, см. container_stats.h)
+template<typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats>
+class Deque : private Stats {
+private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using MapAllocator = typename AllocTraits::template rebind_alloc<T*>;
+    using MapTraits = std::allocator_traits<MapAllocator>;
+
+    static constexpr size_t block_shift = deque_block_shift<T>();
+    static constexpr size_t block_size = size_t(1) << block_shift;
+    static constexpr size_t block_mask = block_size - 1;
+    static constexpr size_t min_map_size = 8;
+
+    T** map_;          // Карта блоков (nullptr, пока ничего не выделено)
+    size_t map_size_;  // Количество слотов карты
+    size_t blocks_;    // Количество выделенных блоков (занятых и запасных)
+    size_t start_;     // Сквозной номер слота первого элемента
+    size_t size_;      // Количество элементов
+    Allocator alloc;   // Аллокатор блоков (карта выделяется его копией для T*)
+
+    T* allocate_block() {
+        T* block = AllocTraits::allocate(alloc, block_size);
+        Stats::on_allocate(block_size * sizeof(T));
+        ++blocks_;
+        return block;
+    }
+
+    void deallocate_block(T* block) {
+        AllocTraits::deallocate(alloc, block, block_size);
+        Stats::on_deallocate(block_size * sizeof(T));
+        --blocks_;
+    }
+
+    // Карта из n пустых слотов
+    T** allocate_map(size_t n) {
+        MapAllocator map_alloc(alloc);
+        T** map = MapTraits::allocate(map_alloc, n);
+        Stats::on_allocate(n * sizeof(T*));
+        for (size_t i = 0; i < n; ++i) {
+            map[i] = nullptr;
+        }
+        return map;
+    }
+
+    void deallocate_map(T** map, size_t n) {
+        if (map) {
+            MapAllocator map_alloc(alloc);
+            MapTraits::deallocate(map_alloc, map, n);
+            Stats::on_deallocate(n * sizeof(T*));
+        }
+    }
+
+    template<typename... Args>
+    void construct(T* p, Args&&... args) {
+        AllocTraits::construct(alloc, p, std::forward<Args>(args)...);
+        count_construction<T, Args&&...>(static_cast<Stats&>(*this));
+    }
+
+    template<typename U>
+    void assign_element(T& dst, U&& src) {
+        dst = std::forward<U>(src);
+        count_assignment<T, U&&>(static_cast<Stats&>(*this));
+    }
+
+    void destroy_one(T* p) {
+        AllocTraits::destroy(alloc, p);
+    }
+
+    // Адрес слота со сквозным номером global (блок должен быть выделен)
+    T* slot(size_t global) const {
+        return map_[global >> block_shift] + (global & block_mask);
+    }
+
+    // Элемент по индексу без проверки границ
+    T& element(size_t index) const {
+        return *slot(start_ + index);
+    }
+
+    // Адрес свободного слота global; блок выделяется, если в карте на его месте пусто
+    T* prepare_slot(size_t global) {
+        T*& block = map_[global >> block_shift];
+        if (!block) {
+            block = allocate_block();
+        }
+        return block + (global & block_mask);
+    }
+
+    // Сдвиг count элементов с индекса from на индекс to присваиванием.
+    // Обход идет кусками в пределах блоков: к началу (to < from) - от первого
+    // элемента, к концу - от последнего. Тривиально копируемые элементы
+    // переносятся memmove целыми кусками.
+    void shift_elements(size_t from, size_t to, size_t count) {
+        if (to < from) {
+            size_t src = start_ + from;
+            size_t dst = start_ + to;
+            while (count != 0) {
+                size_t n = std::min({count, block_size - (src & block_mask), block_size - (dst & block_mask)});
+                move_chunk(slot(dst), slot(src), n, true);
+                src += n;
+                dst += n;
+                count -= n;
+            }
+        } else {
+            size_t src_end = start_ + from + count;
+            size_t dst_end = start_ + to + count;
+            while (count != 0) {
+                size_t n = std::min({count, ((src_end - 1) & block_mask) + 1, ((dst_end - 1) & block_mask) + 1});
+                src_end -= n;
+                dst_end -= n;
+                move_chunk(slot(dst_end), slot(src_end), n, false);
+                count -= n;
+            }
+        }
+    }
+
+    // Перемещающее присваивание n подряд лежащих элементов (области могут перекрываться)
+    void move_chunk(T* dst, T* src, size_t n, bool forward) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            Stats::on_relocate(n);
+        } else if (forward) {
+            for (size_t i = 0; i < n; ++i) {
+                assign_element(dst[i], std::move(src[i]));
+            }
+        } else {
+            for (size_t i = n; i > 0; --i) {
+                assign_element(dst[i - 1], std::move(src[i - 1]));
+            }
+        }
+    }
+
+    // Перестройка карты, когда с одного из концов не осталось слотов:
+    // занятые блоки ставятся в середину карты. Если занято не больше
+    // половины, карта сдвигается по кругу на месте - запасные блоки уходят в
+    // освободившиеся слоты на другом конце (очередь push_back/pop_front так
+    // работает без выделений памяти). Иначе карта вдвое больше, запасные
+    // блоки ставятся в свободные слоты после и перед занятыми.
+    // Сами элементы не перемещаются.
+    void rebuild_map() {
+        size_t first_block = start_ >> block_shift;
+        size_t used = size_ == 0 ? 0 : ((start_ + size_ - 1) >> block_shift) - first_block + 1;
+        size_t new_size = map_size_ < min_map_size ? min_map_size : map_size_;
+        while (new_size < 2 * (used + 1)) {
+            new_size *= 2;
+        }
+        size_t new_first = (new_size - used) / 2;
+
+        if (new_size == map_size_) {
+            if (new_first < first_block) {
+                std::rotate(map_, map_ + (first_block - new_first), map_ + map_size_);
+            } else {
+                std::rotate(map_, map_ + map_size_ - (new_first - first_block), map_ + map_size_);
+            }
+        } else {
+            T** new_map = allocate_map(new_size);
+            Stats::on_reallocate();
+            for (size_t i = 0; i < used; ++i) {
+                new_map[new_first + i] = map_[first_block + i];
+            }
+            size_t back_slot = new_first + used;
+            size_t front_slot = new_first;
+            for (size_t b = 0; b < map_size_; ++b) {
+                if (map_[b] && (b < first_block || b >= first_block + used)) {
+                    if (back_slot < new_size) {
+                        new_map[back_slot++] = map_[b];
+                    } else if (front_slot > 0) {
+                        new_map[--front_slot] = map_[b];
+                    } else {
+                        deallocate_block(map_[b]);
+                    }
+                }
+            }
+            deallocate_map(map_, map_size_);
+            map_ = new_map;
+            map_size_ = new_size;
+        }
+        start_ = (new_first << block_shift) + (start_ & block_mask);
+    }
+
+    // Уничтожение count элементов с начала или с конца (без проверок)
+    void drop_front(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            destroy_one(slot(start_));
+            ++start_;
+            --size_;
+        }
+    }
+
+    void drop_back(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            --size_;
+            destroy_one(slot(start_ + size_));
+        }
+    }
+
+    // Освобождение всех блоков и карты (элементы должны быть уже уничтожены)
+    void release_storage() {
+        for (size_t b = 0; b < map_size_; ++b) {
+            if (map_[b]) {
+                deallocate_block(map_[b]);
+            }
+        }
+        deallocate_map(map_, map_size_);
+        map_ = nullptr;
+        map_size_ = 0;
+        start_ = 0;
+    }
+
+    // Перехват карты другой очереди (текущая очередь должна быть без памяти)
+    void take_storage(Deque& other) noexcept {
+        map_ = other.map_;
+        map_size_ = other.map_size_;
+        blocks_ = other.blocks_;
+        start_ = other.start_;
+        size_ = other.size_;
+
+        other.map_ = nullptr;
+        other.map_size_ = 0;
+        other.blocks_ = 0;
+        other.start_ = 0;
+        other.size_ = 0;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    Deque() : map_(nullptr), map_size_(0), blocks_(0), start_(0), size_(0), alloc() {}
+
+    explicit Deque(const Allocator& allocator)
+        : map_(nullptr), map_size_(0), blocks_(0), start_(0), size_(0), alloc(allocator) {}
+
+    // Копирующий конструктор
+    Deque(const Deque& other)
+        : Deque(other, AllocTraits::select_on_container_copy_construction(other.alloc)) {}
+
+    // Копирующий конструктор с заданным аллокатором. Конструктор делегирует,
+    // поэтому при исключении уже скопированное освободит деструктор.
+    Deque(const Deque& other, const Allocator& allocator) : Deque(allocator) {
+        for (size_t i = 0; i < other.size_; ++i) {
+            emplace_back(other.element(i));
+        }
+    }
+
+    // Перемещающий конструктор: карта и блоки переходят целиком
+    Deque(Deque&& other) noexcept : Deque(std::move(other.alloc)) {
+        take_storage(other);
+    }
+
+    // Копирующий оператор присваивания
+    Deque& operator=(const Deque& other) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                // Блоки, выделенные другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    clear();
+                    release_storage();
+                }
+                alloc = other.alloc;
+            }
+            // Элементы и блоки текущей очереди переиспользуются
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // Перемещающий оператор присваивания
+    Deque& operator=(Deque&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                             AllocTraits::is_always_equal::value) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                clear();
+                release_storage();
+                alloc = std::move(other.alloc);
+                take_storage(other);
+            } else if (alloc == other.alloc) {
+                clear();
+                release_storage();
+                take_storage(other);
+            } else {
+                // Память другого аллокатора перехватить нельзя: перемещаем поэлементно
+                clear();
+                for (size_t i = 0; i < other.size_; ++i) {
+                    emplace_back(std::move(other.element(i)));
+                }
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~Deque() {
+        clear();
+        release_storage();
+    }
+
+    void swap(Deque& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc, other.alloc);
+        }
+        std::swap(map_, other.map_);
+        std::swap(map_size_, other.map_size_);
+        std::swap(blocks_, other.blocks_);
+        std::swap(start_, other.start_);
+        std::swap(size_, other.size_);
+    }
+
+    Allocator get_allocator() const {
+        return alloc;
+    }
+
+    // Доступ по индексу за O(1)
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return element(index);
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return element(index);
+    }
+
+    T& at(size_t index) {
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        return (*this)[index];
+    }
+
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустой очереди");
+        }
+        return element(0);
+    }
+
+    const T& front() const {
+        return const_cast<Deque&>(*this).front();
+    }
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустой очереди");
+        }
+        return element(size_ - 1);
+    }
+
+    const T& back() const {
+        return const_cast<Deque&>(*this).back();
+    }
+
+    // Конструирование элемента в конце. Существующие элементы не
+    // перемещаются, поэтому аргументы могут ссылаться на них.
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (((start_ + size_) >> block_shift) >= map_size_) {
+            rebuild_map();
+        }
+        T* p = prepare_slot(start_ + size_);
+        construct(p, std::forward<Args>(args)...);
+        ++size_;
+        return *p;
+    }
+
+    // Конструирование элемента в начале
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (start_ == 0) {
+            rebuild_map();
+        }
+        T* p = prepare_slot(start_ - 1);
+        construct(p, std::forward<Args>(args)...);
+        --start_;
+        ++size_;
+        return *p;
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустой очереди");
+        }
+        drop_back(1);
+    }
+
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустой очереди");
+        }
+        drop_front(1);
+    }
+
+    // Конструирование элемента на месте в позиции pos: сдвигается меньшая
+    // из частей - до pos (к началу) или после pos (к концу)
+    template<typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        if (pos == size_) {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+        if (pos == 0) {
+            return emplace_front(std::forward<Args>(args)...);
+        }
+
+        // Аргументы могут ссылаться на сдвигаемые элементы
+        T tmp(std::forward<Args>(args)...);
+        if (pos < size_ - pos) {
+            // Первый элемент дублируется перед началом, [1, pos) сдвигается на шаг влево
+            emplace_front(std::move(element(0)));
+            shift_elements(2, 1, pos - 1);
+        } else {
+            // Последний элемент дублируется после конца, хвост сдвигается на шаг вправо
+            emplace_back(std::move(element(size_ - 1)));
+            shift_elements(pos, pos + 1, size_ - 2 - pos);
+        }
+        assign_element(element(pos), std::move(tmp));
+        return element(pos);
+    }
+
+    void insert(size_t pos, const T& value) {
+        emplace(pos, value);
+    }
+
+    void insert(size_t pos, T&& value) {
+        emplace(pos, std::move(value));
+    }
+
+    // Удаление элемента по позиции (сдвигается меньшая из частей)
+    void erase(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        erase(pos, pos + 1);
+    }
+
+    // Удаление элементов с позициями [first, last): элементы перед first
+    // сдвигаются вправо или элементы после last - влево, смотря какая часть короче
+    void erase(size_t first, size_t last) {
+        if (first > last || last > size_) {
+            throw std::out_of_range("Диапазон удаления вне диапазона");
+        }
+        size_t count = last - first;
+        if (count == 0) {
+            return;
+        }
+
+        if (first < size_ - last) {
+            shift_elements(0, count, first);
+            drop_front(count);
+        } else {
+            shift_elements(last, first, size_ - last);
+            drop_back(count);
+        }
+    }
+
+    // Удаление всех элементов; блоки остаются для повторного использования,
+    // отсчет слотов начинается с середины карты
+    void clear() {
+        drop_back(size_);
+        start_ = (map_size_ / 2) << block_shift;
+    }
+
+    // Замена содержимого элементами диапазона [first, last): живым элементам
+    // присваиваются новые значения, недостающие добавляются в конец (в уже
+    // выделенные блоки, если их хватает), лишние уничтожаются. Диапазон не
+    // должен указывать на элементы самой очереди.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        size_t i = 0;
+        for (; i < size_ && first != last; ++i, ++first) {
+            assign_element(element(i), *first);
+        }
+        drop_back(size_ - i);
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Возврат аллокатору блоков, не занятых элементами (и карты, если очередь пуста)
+    void shrink_to_fit() {
+        if (size_ == 0) {
+            release_storage();
+            return;
+        }
+        size_t first_block = start_ >> block_shift;
+        size_t last_block = (start_ + size_ - 1) >> block_shift;
+        for (size_t b = 0; b < map_size_; ++b) {
+            if (map_[b] && (b < first_block || b > last_block)) {
+                deallocate_block(map_[b]);
+                map_[b] = nullptr;
+            }
+        }
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Память, занимаемая очередью: объект, карта и все выделенные блоки
+    size_t memory_footprint() const {
+        return sizeof(*this) + map_size_ * sizeof(T*) + blocks_ * block_size * sizeof(T);
+    }
+
+    // Счетчики политики статистики (для NoStats - пустой объект)
+    const Stats& stats() const {
+        return *this;
+    }
+
+    Stats& stats() {
+        return *this;
+    }
+
+    // Итератор произвольного доступа: указатель на карту и сквозной номер слота;
+    // const_iterator дает доступ к элементам только на чтение
+    template<bool Const>
+    class basic_iterator {
+    private:
+        template<bool>
+        friend class basic_iterator;
+
+        T** map;     // Карта блоков очереди
+        size_t pos;  // Сквозной номер слота текущего элемента
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : map(nullptr), pos(0) {}
+
+        basic_iterator(T** m, size_t p) : map(m), pos(p) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : map(other.map), pos(other.pos) {}
+
+        reference operator*() const {
+            return map[pos >> block_shift][pos & block_mask];
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        reference operator[](difference_type n) const {
+            return *(*this + n);
+        }
+
+        basic_iterator& operator++() {
+            ++pos;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++pos;
+            return temp;
+        }
+
+        basic_iterator& operator--() {
+            --pos;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;
+            --pos;
+            return temp;
+        }
+
+        basic_iterator& operator+=(difference_type n) {
+            pos += static_cast<size_t>(n);
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type n) {
+            pos -= static_cast<size_t>(n);
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return it += n;
+        }
+
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return it += n;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.pos - b.pos);
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.pos == b.pos;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.pos != b.pos;
+        }
+
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return a.pos < b.pos;
+        }
+
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return a.pos > b.pos;
+        }
+
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return a.pos <= b.pos;
+        }
+
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return a.pos >= b.pos;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    iterator begin() {
+        return iterator(map_, start_);
+    }
+
+    iterator end() {
+        return iterator(map_, start_ + size_);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(map_, start_);
+    }
+
+    const_iterator end() const {
+        return const_iterator(map_, start_ + size_);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+};
+
+#endif
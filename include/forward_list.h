@@ -1,294 +1,663 @@
 #ifndef FORWARD_LIST_H
 #define FORWARD_LIST_H
 
+#include "container_stats.h"
+#include "index_set.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 // Класс ForwardList
-template<typename T>
-class ForwardList {
+// Stats - политика статистики (NoStats или ContainerStats, см. container_stats.h)
+template<typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats>
+class ForwardList : private Stats {
 private:
-    struct Node {
+    // Часть узла со ссылкой на следующий. Из нее же состоит фиктивный узел
+    // перед первым элементом, на который указывает before_begin()
+    struct NodeBase {
+        NodeBase* next;  // Указатель на следующий узел
+
+        NodeBase() : next(nullptr) {}
+    };
+
+    struct Node : NodeBase {
         T data;         // Данные, хранящиеся в узле
-        Node* next;     // Указатель на следующий узел
-        
+
         // Конструктор для l-value ссылок
-        Node(const T& value) : data(value), next(nullptr) {}
-        
+        Node(const T& value) : data(value) {}
+
         // Конструктор для r-value ссылок с перемещением
-        Node(T&& value) : data(std::move(value)), next(nullptr) {}
+        Node(T&& value) : data(std::move(value)) {}
+
+        // Конструирование данных на месте из произвольных аргументов
+        template<typename... Args>
+        Node(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...) {}
     };
-    
-    Node* head;     // Указатель на первый узел списка
-    size_t size_;   // Количество элементов в списке
-    
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using PointerAllocator = typename NodeTraits::template rebind_alloc<Node*>;
+    using PointerTraits = std::allocator_traits<PointerAllocator>;
+
+    NodeBase before_head;  // Фиктивный узел: before_head.next - первый узел списка
+    NodeBase* tail;        // Последний узел (или &before_head, если список пуст)
+    size_t size_;          // Количество элементов в списке
+    NodeAllocator alloc;   // Аллокатор узлов
+
+    static Node* as_node(NodeBase* base) {
+        return static_cast<Node*>(base);
+    }
+
+    // Выделение памяти под узел и его конструирование
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc, 1);
+        Stats::on_allocate(sizeof(Node));
+        try {
+            NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc, node, 1);
+            Stats::on_deallocate(sizeof(Node));
+            throw;
+        }
+        count_construction<T, Args&&...>(static_cast<Stats&>(*this));
+        return node;
+    }
+
+    // Уничтожение узла и возврат памяти аллокатору
+    void destroy_node(Node* node) {
+        NodeTraits::destroy(alloc, node);
+        NodeTraits::deallocate(alloc, node, 1);
+        Stats::on_deallocate(sizeof(Node));
+    }
+
+    // Присваивание данным существующего узла (с учетом в статистике)
+    template<typename U>
+    void assign_element(T& dst, U&& src) {
+        dst = std::forward<U>(src);
+        count_assignment<T, U&&>(static_cast<Stats&>(*this));
+    }
+
+    // Вставка узла после pos за O(1)
+    void link_after(NodeBase* pos, Node* node) {
+        node->next = pos->next;  // Новый узел указывает на следующий за pos
+        pos->next = node;        // pos теперь указывает на новый узел
+        if (pos == tail) {
+            tail = node;         // Вставка в конец - обновляем хвост
+        }
+        ++size_;
+    }
+
+    // Удаление узла, следующего за pos, за O(1)
+    void unlink_after(NodeBase* pos) {
+        Node* temp = as_node(pos->next);  // Удаляемый узел
+        pos->next = temp->next;           // Пропускаем удаляемый узел
+        if (temp == tail) {
+            tail = pos;
+        }
+        destroy_node(temp);               // Освобождаем память
+        --size_;
+    }
+
+    // Узел, предшествующий позиции pos (для pos == 0 - фиктивный узел)
+    NodeBase* node_before(size_t pos) {
+        if (pos == size_) {
+            return tail;
+        }
+        NodeBase* current = &before_head;
+        Stats::on_node_hops(pos);
+        for (size_t i = 0; i < pos; ++i) {
+            current = current->next;
+        }
+        return current;
+    }
+
+    // Перехват узлов другого списка (текущий список должен быть пуст)
+    void take_nodes(ForwardList& other) noexcept {
+        before_head.next = other.before_head.next;
+        tail = other.size_ ? other.tail : &before_head;
+        size_ = other.size_;
+
+        // Обнуляем указатели исходного списка
+        other.before_head.next = nullptr;
+        other.tail = &other.before_head;
+        other.size_ = 0;
+    }
+
+    // Добавление в конец копий элементов другого списка
+    void append_copy(const ForwardList& other) {
+        for (NodeBase* current = other.before_head.next; current; current = current->next) {
+            link_after(tail, create_node(as_node(current)->data));
+        }
+    }
+
 public:
-    ForwardList() : head(nullptr), size_(0) {}
-    
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    ForwardList() : tail(&before_head), size_(0), alloc() {}
+
+    // Пустой список с заданным аллокатором (например, PoolAllocator или std::pmr::polymorphic_allocator)
+    explicit ForwardList(const Allocator& allocator) : tail(&before_head), size_(0), alloc(allocator) {}
+
     // Копирующий конструктор
-    ForwardList(const ForwardList& other) : head(nullptr), size_(0) {
-        Node* current = other.head;  // Указатель для обхода исходного списка
-        Node* prev = nullptr;        // Указатель на последний созданный узел
-        
-        // Поэлементное копирование всех узлов
-        while (current) {
-            Node* new_node = new Node(current->data);  // Создаем копию узла
-            
-            // Устанавливаем head для первого узла
-            if (!head) {
-                head = new_node;
-            } else {
-                prev->next = new_node;  // Связываем предыдущий узел с новым
-            }
-            
-            prev = new_node;           // Обновляем указатель на последний узел
-            current = current->next;   // Переходим к следующему узлу
-            ++size_;                   // Увеличиваем счетчик размера
+    ForwardList(const ForwardList& other)
+        : ForwardList(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {}
+
+    // Копирующий конструктор с заданным аллокатором
+    ForwardList(const ForwardList& other, const Allocator& allocator)
+        : tail(&before_head), size_(0), alloc(allocator) {
+        try {
+            append_copy(other);  // Поэлементное копирование всех узлов
+        } catch (...) {
+            clear();
+            throw;
         }
     }
-    
+
     // Перемещающий конструктор
-    ForwardList(ForwardList&& other) noexcept 
-        : head(other.head), size_(other.size_) {
-        // Обнуляем указатели исходного списка, чтобы избежать двойного удаления
-        other.head = nullptr;
-        other.size_ = 0;
+    ForwardList(ForwardList&& other) noexcept
+        : tail(&before_head), size_(0), alloc(std::move(other.alloc)) {
+        take_nodes(other);
     }
-    
+
     // Копирующий оператор присваивания
     ForwardList& operator=(const ForwardList& other) {
         // Проверка на самоприсваивание
         if (this != &other) {
-            clear();  // Освобождаем текущие ресурсы
-            
-            // Копируем элементы как в копирующем конструкторе
-            Node* current = other.head;
-            Node* prev = nullptr;
-            while (current) {
-                Node* new_node = new Node(current->data);
-                if (!head) {
-                    head = new_node;
-                } else {
-                    prev->next = new_node;
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+                // Узлы, выделенные другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    clear();
                 }
-                prev = new_node;
-                current = current->next;
-                ++size_;
+                alloc = other.alloc;
             }
+
+            // Существующие узлы получают новые значения, создаются только недостающие
+            assign(other.begin(), other.end());
         }
         return *this;  // Возвращаем ссылку на текущий объект
     }
-    
+
     // Перемещающий оператор присваивания
-    ForwardList& operator=(ForwardList&& other) noexcept {
+    ForwardList& operator=(ForwardList&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value ||
+                                                         NodeTraits::is_always_equal::value) {
         if (this != &other) {
             clear();  // Освобождаем текущие ресурсы
-            
-            // Перехватываем ресурсы другого списка
-            head = other.head;
-            size_ = other.size_;
-            
-            // Обнуляем указатели исходного списка
-            other.head = nullptr;
-            other.size_ = 0;
+
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                alloc = std::move(other.alloc);
+                take_nodes(other);  // Перехватываем ресурсы другого списка
+            } else if (alloc == other.alloc) {
+                take_nodes(other);
+            } else {
+                // Узлы чужого аллокатора перехватить нельзя: перемещаем элементы
+                for (NodeBase* current = other.before_head.next; current; current = current->next) {
+                    link_after(tail, create_node(std::move(as_node(current)->data)));
+                }
+                other.clear();
+            }
         }
         return *this;
     }
-    
+
     ~ForwardList() {
         clear();
     }
-    
-    // Очистка списка 
+
+    // Очистка списка
     void clear() {
-        while (head) {
-            Node* temp = head;    // Сохраняем указатель на текущий узел
-            head = head->next;    // Перемещаем head на следующий узел
-            delete temp;          // Освобождаем память текущего узла
+        NodeBase* current = before_head.next;
+        while (current) {
+            Node* temp = as_node(current);  // Сохраняем указатель на текущий узел
+            current = current->next;        // Переходим к следующему узлу
+            destroy_node(temp);             // Освобождаем память текущего узла
         }
-        size_ = 0; 
+        before_head.next = nullptr;
+        tail = &before_head;
+        size_ = 0;
     }
-    
-    // Добавление элемента в конец списка (для l-value)
-    void push_back(const T& value) {
-        Node* new_node = new Node(value);  // Создаем новый узел
-        
-        if (!head) {
-            // Если список пуст, новый узел становится головой
-            head = new_node;
-        } else {
-            // Ищем последний узел
-            Node* current = head;
-            while (current->next) {
-                current = current->next;
+
+    // Очистка без возврата узлов аллокатору: вызываются только деструкторы
+    // элементов (для тривиально уничтожаемых T - O(1), без прохода по узлам).
+    // Для списков в пуле, который затем освобождает всю память сразу за
+    // O(числа блоков) (NodePool::release()). С обычным аллокатором узлы утекают.
+    void discard_nodes() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            NodeBase* current = before_head.next;
+            while (current) {
+                NodeBase* next = current->next;
+                NodeTraits::destroy(alloc, as_node(current));
+                current = next;
             }
-            current->next = new_node;  // Присоединяем новый узел в конец
         }
-        ++size_;
+        before_head.next = nullptr;
+        tail = &before_head;
+        size_ = 0;
     }
-    
-    // Добавление элемента в конец списка (для r-value - с перемещением)
-    void push_back(T&& value) {
-        Node* new_node = new Node(std::move(value));  // Перемещаем значение
-        if (!head) {
-            head = new_node;
-        } else {
-            Node* current = head;
-            while (current->next) {
-                current = current->next;
+
+    // Замена содержимого элементами диапазона [first, last): существующие узлы
+    // получают новые значения, узлы создаются только для недостающих элементов,
+    // а освобождаются только лишние. Диапазон не должен указывать на элементы
+    // самого списка.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        NodeBase* prev = &before_head;
+        for (; prev->next && first != last; prev = prev->next, ++first) {
+            assign_element(as_node(prev->next)->data, *first);
+        }
+        if (first == last) {
+            while (prev->next) {
+                unlink_after(prev);
             }
-            current->next = new_node;
         }
-        ++size_;
+        for (; first != last; ++first) {
+            link_after(tail, create_node(*first));
+        }
+    }
+
+    // Добавление элемента в конец списка (для l-value) за O(1) благодаря указателю на хвост
+    void push_back(const T& value) {
+        link_after(tail, create_node(value));
+    }
+
+    // Добавление элемента в конец списка (для r-value - с перемещением)
+    void push_back(T&& value) {
+        link_after(tail, create_node(std::move(value)));
+    }
+
+    // Конструирование элемента на месте в конце списка
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* new_node = create_node(std::in_place, std::forward<Args>(args)...);
+        link_after(tail, new_node);
+        return new_node->data;
     }
-    
+
     // Добавление элемента в начало списка (для l-value)
     void push_front(const T& value) {
-        Node* new_node = new Node(value);
-        new_node->next = head;  // Новый узел указывает на старую голову
-        head = new_node;        // Новый узел становится новой головой
-        ++size_;
+        link_after(&before_head, create_node(value));
     }
-    
+
     // Добавление элемента в начало списка (для r-value)
     void push_front(T&& value) {
-        Node* new_node = new Node(std::move(value));
-        new_node->next = head;
-        head = new_node;
-        ++size_;
+        link_after(&before_head, create_node(std::move(value)));
+    }
+
+    // Конструирование элемента на месте в начале списка
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        Node* new_node = create_node(std::in_place, std::forward<Args>(args)...);
+        link_after(&before_head, new_node);
+        return new_node->data;
+    }
+
+    // Первый элемент за O(1)
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return as_node(before_head.next)->data;
     }
-    
+
+    const T& front() const {
+        return const_cast<ForwardList&>(*this).front();
+    }
+
+    // Последний элемент за O(1) (хвост хранится)
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return as_node(tail)->data;
+    }
+
+    const T& back() const {
+        return const_cast<ForwardList&>(*this).back();
+    }
+
+    // Удаление первого элемента
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        unlink_after(&before_head);
+    }
+
     // Вставка элемента в произвольную позицию (для l-value)
     void insert(size_t pos, const T& value) {
         // Проверка корректности позиции
         if (pos > size_) {
             throw std::out_of_range("Недопустимая позиция для вставки");
         }
-        
-        // Если вставка в начало, используем push_front
-        if (pos == 0) {
-            push_front(value);
-            return;
-        }
-        
-        // Находим узел, предшествующий позиции вставки
-        Node* current = head;
-        for (size_t i = 0; i < pos - 1; ++i) {
-            current = current->next;
-        }
-        
-        // Создаем новый узел и вставляем его после current
-        Node* new_node = new Node(value);
-        new_node->next = current->next;  // Новый узел указывает на следующий за current
-        current->next = new_node;        // current теперь указывает на новый узел
-        ++size_;
+
+        // Находим узел, предшествующий позиции вставки, и вставляем после него
+        link_after(node_before(pos), create_node(value));
     }
-    
+
     // Вставка элемента в произвольную позицию (для r-value)
     void insert(size_t pos, T&& value) {
         if (pos > size_) {
             throw std::out_of_range("Недопустимая позиция для вставки");
         }
-        
-        if (pos == 0) {
-            push_front(std::move(value));
-            return;
-        }
-        
-        // Находим узел перед позицией вставки
-        Node* current = head;
-        for (size_t i = 0; i < pos - 1; ++i) {
-            current = current->next;
-        }
-        
-        Node* new_node = new Node(std::move(value));
-        new_node->next = current->next;
-        current->next = new_node;
-        ++size_;
+
+        link_after(node_before(pos), create_node(std::move(value)));
     }
-    
+
     // Удаление элемента по позиции
     void erase(size_t pos) {
         if (pos >= size_) {
             throw std::out_of_range("Недопустимая позиция для удаления");
         }
-        
-        if (pos == 0) {
-            // Удаление первого элемента
-            Node* temp = head;       // Сохраняем указатель на удаляемый узел
-            head = head->next;       // Перемещаем голову на следующий узел
-            delete temp;             // Освобождаем память
-        } else {
-            // Удаление элемента в середине или конце
-            Node* current = head;
-            // Находим узел перед удаляемым
-            for (size_t i = 0; i < pos - 1; ++i) {
-                current = current->next;
-            }
-            
-            Node* temp = current->next;    // Удаляемый узел
-            current->next = temp->next;    // Пропускаем удаляемый узел
-            delete temp;                   // Освобождаем память
+
+        // Находим узел перед удаляемым (для pos == 0 - фиктивный узел)
+        NodeBase* current = &before_head;
+        Stats::on_node_hops(pos);
+        for (size_t i = 0; i < pos; ++i) {
+            current = current->next;
         }
-        --size_;
+        unlink_after(current);
     }
-    
+
     // Получение количества элементов в списке
     size_t size() const {
         return size_;
     }
-    
-    // Вложенный класс итератора для обхода списка
-    class iterator {
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Память, занимаемая списком: сам объект и все узлы.
+    // Память, которой владеют сами элементы (например, строки), не учитывается.
+    size_t memory_footprint() const {
+        return sizeof(*this) + size_ * sizeof(Node);
+    }
+
+    // Средний шаг по адресам между соседними узлами, в байтах: мера
+    // локальности обхода (см. List::average_node_stride())
+    double average_node_stride() const {
+        if (size_ < 2) {
+            return 0.0;
+        }
+        double total = 0.0;
+        uintptr_t previous = reinterpret_cast<uintptr_t>(before_head.next);
+        for (const NodeBase* current = before_head.next->next; current; current = current->next) {
+            uintptr_t address = reinterpret_cast<uintptr_t>(current);
+            total += static_cast<double>(address > previous ? address - previous : previous - address);
+            previous = address;
+        }
+        return total / static_cast<double>(size_ - 1);
+    }
+
+    // Счетчики политики статистики (для NoStats - пустой объект)
+    const Stats& stats() const {
+        return *this;
+    }
+
+    Stats& stats() {
+        return *this;
+    }
+
+    Allocator get_allocator() const {
+        return Allocator(alloc);
+    }
+
+    // Вложенный класс итератора для обхода списка (однонаправленный);
+    // const_iterator дает доступ к элементам только на чтение
+    template<bool Const>
+    class basic_iterator {
     private:
-        Node* current;  // Указатель на текущий узел
-        
+        friend class ForwardList;
+        template<bool>
+        friend class basic_iterator;
+
+        NodeBase* current;  // Указатель на текущий узел
+
     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : current(nullptr) {}
+
         // Конструктор итератора
-        iterator(Node* node) : current(node) {}
-        
+        explicit basic_iterator(NodeBase* node) : current(node) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : current(other.current) {}
+
         // Оператор разыменования
-        T& operator*() {
-            return current->data;
+        reference operator*() const {
+            return as_node(current)->data;
+        }
+
+        pointer operator->() const {
+            return &as_node(current)->data;
         }
-        
+
         // Префиксный инкремент
-        iterator& operator++() {
+        basic_iterator& operator++() {
             if (current) {
                 current = current->next;  // Переходим к следующему узлу
             }
             return *this;
         }
-        
+
         // Постфиксный инкремент
-        iterator operator++(int) {
-            iterator temp = *this;  // Сохраняем текущее состояние
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;  // Сохраняем текущее состояние
             if (current) {
                 current = current->next;
             }
             return temp;  // Возвращаем старое состояние
         }
-        
-        // Операторы сравнения для использования в циклах
-        bool operator!=(const iterator& other) const {
-            return current != other.current;
+
+        // Операторы сравнения (iterator и const_iterator сравниваются между собой)
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.current == b.current;
         }
-        
-        bool operator==(const iterator& other) const {
-            return current == other.current;
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.current != b.current;
         }
     };
-    
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // Итератор на фиктивную позицию перед первым элементом (для insert_after/erase_after)
+    iterator before_begin() {
+        return iterator(&before_head);
+    }
+
     // Метод для получения итератора на начало списка
     iterator begin() {
-        return iterator(head);
+        return iterator(before_head.next);
     }
-    
+
     // Метод для получения итератора на конец списка
     iterator end() {
         return iterator(nullptr);
     }
+
+    const_iterator before_begin() const {
+        return const_iterator(const_cast<NodeBase*>(&before_head));
+    }
+
+    const_iterator begin() const {
+        return const_iterator(before_head.next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cbefore_begin() const {
+        return before_begin();
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // Конструирование элемента на месте после pos за O(1).
+    // Возвращает итератор на вставленный элемент.
+    template<typename... Args>
+    iterator emplace_after(iterator pos, Args&&... args) {
+        if (!pos.current) {
+            throw std::out_of_range("Недопустимая позиция для вставки");
+        }
+        Node* new_node = create_node(std::in_place, std::forward<Args>(args)...);
+        link_after(pos.current, new_node);
+        return iterator(new_node);
+    }
+
+    // Вставка элемента после pos за O(1) (для l-value)
+    iterator insert_after(iterator pos, const T& value) {
+        return emplace_after(pos, value);
+    }
+
+    // Вставка элемента после pos за O(1) (для r-value)
+    iterator insert_after(iterator pos, T&& value) {
+        return emplace_after(pos, std::move(value));
+    }
+
+    // Удаление элемента, следующего за pos, за O(1).
+    // Возвращает итератор на элемент, следующий за удаленным.
+    iterator erase_after(iterator pos) {
+        if (!pos.current || !pos.current->next) {
+            throw std::out_of_range("Недопустимая позиция для удаления");
+        }
+        unlink_after(pos.current);
+        return iterator(pos.current->next);
+    }
+
+    // Удаление элементов в интервале (first, last). Возвращает last.
+    iterator erase_after(iterator first, iterator last) {
+        if (!first.current) {
+            throw std::out_of_range("Недопустимая позиция для удаления");
+        }
+        while (first.current->next != last.current) {
+            unlink_after(first.current);
+        }
+        return last;
+    }
+
+    // Удаление всех элементов, удовлетворяющих предикату, за один проход.
+    // Возвращает количество удаленных элементов.
+    template<typename Predicate>
+    size_t erase_if(Predicate pred) {
+        size_t removed = 0;
+        NodeBase* prev = &before_head;
+        while (prev->next) {
+            if (pred(as_node(prev->next)->data)) {
+                unlink_after(prev);
+                ++removed;
+            } else {
+                prev = prev->next;
+            }
+        }
+        return removed;
+    }
+
+    // Удаление элементов с позициями из [first, last) (в любом порядке, повторы
+    // допускаются) за один проход до последней удаляемой позиции:
+    // O(n + k log k) вместо O(k * n) при удалении по одному.
+    // Возвращает количество удаленных элементов.
+    template<typename InputIt>
+    size_t erase_indices(InputIt first, InputIt last) {
+        std::vector<size_t> indices = sorted_index_set(first, last, size_);
+        NodeBase* prev = &before_head;  // Узел перед позицией position
+        size_t position = 0;
+        for (size_t index : indices) {
+            Stats::on_node_hops(index - position);
+            for (; position < index; ++position) {
+                prev = prev->next;
+            }
+            unlink_after(prev);  // Следующий узел занимал позицию index + 1
+            ++position;
+        }
+        return indices.size();
+    }
+
+    // Перестройка узлов в порядке списка в память, выделенную подряд
+    // (см. List::relinearize()). Итераторы, указатели и ссылки на элементы
+    // становятся недействительными; при исключении список не меняется.
+    void relinearize() {
+        if (size_ == 0) {
+            return;
+        }
+        // Адреса новых узлов собираются во временный массив и упорядочиваются
+        PointerAllocator pointer_alloc(alloc);
+        Node** nodes = PointerTraits::allocate(pointer_alloc, size_);
+        Stats::on_allocate(size_ * sizeof(Node*));
+        size_t allocated = 0;
+        size_t built = 0;
+
+        // Новые узлы связываются в отдельную цепочку в порядке списка
+        NodeBase fresh;
+        NodeBase* last = &fresh;
+        try {
+            for (; allocated < size_; ++allocated) {
+                nodes[allocated] = NodeTraits::allocate(alloc, 1);
+                Stats::on_allocate(sizeof(Node));
+            }
+            std::sort(nodes, nodes + size_, std::less<Node*>());
+            for (NodeBase* current = before_head.next; current; current = current->next, ++built) {
+                NodeTraits::construct(alloc, nodes[built], std::move_if_noexcept(as_node(current)->data));
+                count_construction<T, decltype(std::move_if_noexcept(std::declval<T&>()))>(static_cast<Stats&>(*this));
+                last->next = nodes[built];
+                last = nodes[built];
+            }
+        } catch (...) {
+            for (size_t i = 0; i < built; ++i) {
+                destroy_node(nodes[i]);
+            }
+            for (size_t i = built; i < allocated; ++i) {
+                NodeTraits::deallocate(alloc, nodes[i], 1);
+                Stats::on_deallocate(sizeof(Node));
+            }
+            PointerTraits::deallocate(pointer_alloc, nodes, size_);
+            Stats::on_deallocate(size_ * sizeof(Node*));
+            throw;
+        }
+        PointerTraits::deallocate(pointer_alloc, nodes, size_);
+        Stats::on_deallocate(size_ * sizeof(Node*));
+        last->next = nullptr;
+
+        for (NodeBase* current = before_head.next; current;) {
+            NodeBase* next = current->next;
+            destroy_node(as_node(current));
+            current = next;
+        }
+        before_head.next = fresh.next;
+        tail = last;
+    }
 };
 
-#endif 
\ No newline at end of file
+// Односвязный список, узлы которого выделяются из std::pmr::memory_resource (например, NodePool)
+template<typename T, typename Stats = NoStats>
+using PmrForwardList = ForwardList<T, std::pmr::polymorphic_allocator<T>, Stats>;
+
+#endif
@@ -0,0 +1,655 @@
+#ifndef GAP_VECTOR_H
+#define GAP_VECTOR_H
+
+#include "vector.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Вектор с разрывом (gap buffer): элементы лежат в одном буфере, а свободная
+// емкость собрана в "разрыв" [gap_start_, gap_end_) в позиции последней
+// правки. Элемент с индексом i лежит в ячейке i, если i < gap_start_, и в
+// ячейке i + длина разрыва - иначе.
+//
+// Вставка и удаление в позиции разрыва - O(1): элемент создается в начале
+// разрыва или поглощается им. Правка в другой позиции сначала переносит
+// разрыв туда, сдвигая только элементы между старой и новой позицией, поэтому
+// серия правок рядом с одним курсором (как в текстовом редакторе) стоит O(1)
+// на правку, а не O(n) сдвига хвоста, как у Vector.
+//
+// Stats - политика статистики (NoStats или ContainerStats, см. container_stats.h)
+// Growth - политика роста емкости (см. growth_policy.h)
+template<typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats,
+         typename Growth = DoublingGrowth>
+class GapVector : private Stats {
+private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    T* data_;           // Буфер: элементы до разрыва, разрыв, элементы после разрыва
+    size_t capacity_;   // Емкость буфера
+    size_t gap_start_;  // Первая ячейка разрыва (индекс первого элемента после него)
+    size_t gap_end_;    // Первая ячейка после разрыва
+    Allocator alloc;    // Аллокатор буфера
+
+    static constexpr bool relocatable = is_trivially_relocatable<T>::value;
+
+    T* allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        T* p = AllocTraits::allocate(alloc, n);
+        Stats::on_allocate(n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (p) {
+            AllocTraits::deallocate(alloc, p, n);
+            Stats::on_deallocate(n * sizeof(T));
+        }
+    }
+
+    template<typename... Args>
+    void construct(T* p, Args&&... args) {
+        AllocTraits::construct(alloc, p, std::forward<Args>(args)...);
+        count_construction<T, Args&&...>(static_cast<Stats&>(*this));
+    }
+
+    template<typename U>
+    void assign_element(T& dst, U&& src) {
+        dst = std::forward<U>(src);
+        count_assignment<T, U&&>(static_cast<Stats&>(*this));
+    }
+
+    void destroy_one(T* p) {
+        AllocTraits::destroy(alloc, p);
+    }
+
+    void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                destroy_one(first);
+            }
+        }
+    }
+
+    // Побайтовый сдвиг n элементов (области могут перекрываться)
+    void move_bytes(T* dst, const T* src, size_t n) {
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        Stats::on_relocate(n);
+    }
+
+    // Перенос n элементов из src в неинициализированную память dst
+    // (как в Vector: после вызова элементы src считаются уничтоженными)
+    void relocate(T* src, size_t n, T* dst) {
+        if constexpr (relocatable) {
+            if (n != 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+                Stats::on_relocate(n);
+            }
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    construct(dst + i, std::move_if_noexcept(src[i]));
+                }
+            } catch (...) {
+                destroy(dst, dst + i);
+                throw;
+            }
+            destroy(src, src + n);
+        }
+    }
+
+    size_t gap_length() const {
+        return gap_end_ - gap_start_;
+    }
+
+    // Ячейка элемента с индексом index
+    T* slot(size_t index) const {
+        return data_ + (index < gap_start_ ? index : index + gap_length());
+    }
+
+    // Перенос разрыва к позиции pos (pos <= size()): элементы между старой и
+    // новой позицией переезжают на другую сторону разрыва. Для остальных
+    // типов - по одному элементу, после каждого шага состояние согласовано.
+    void shift_gap(size_t pos) {
+        if (gap_start_ == gap_end_) {
+            gap_start_ = gap_end_ = pos;  // Пустой разрыв можно поставить куда угодно
+            return;
+        }
+        if (pos < gap_start_) {
+            if constexpr (relocatable) {
+                size_t n = gap_start_ - pos;
+                move_bytes(data_ + gap_end_ - n, data_ + pos, n);
+                gap_start_ -= n;
+                gap_end_ -= n;
+            } else {
+                while (gap_start_ > pos) {
+                    construct(data_ + gap_end_ - 1, std::move_if_noexcept(data_[gap_start_ - 1]));
+                    destroy_one(data_ + gap_start_ - 1);
+                    --gap_start_;
+                    --gap_end_;
+                }
+            }
+        } else if (pos > gap_start_) {
+            if constexpr (relocatable) {
+                size_t n = pos - gap_start_;
+                move_bytes(data_ + gap_start_, data_ + gap_end_, n);
+                gap_start_ += n;
+                gap_end_ += n;
+            } else {
+                while (gap_start_ < pos) {
+                    construct(data_ + gap_start_, std::move_if_noexcept(data_[gap_end_]));
+                    destroy_one(data_ + gap_end_);
+                    ++gap_start_;
+                    ++gap_end_;
+                }
+            }
+        }
+    }
+
+    // Перевыделение буфера с разрывом в позиции gap_pos. Разрыв должен быть
+    // пуст или стоять в gap_pos: тогда элементы до и после gap_pos лежат
+    // двумя непрерывными кусками, и каждый элемент переносится один раз.
+    void reallocate(size_t new_capacity, size_t gap_pos) {
+        size_t count = size();
+        size_t tail = count - gap_pos;
+        T* old_tail = data_ + gap_pos + gap_length();
+        T* new_data = allocate(new_capacity);
+        Stats::on_reallocate();
+        try {
+            relocate(data_, gap_pos, new_data);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            relocate(old_tail, tail, new_data + new_capacity - tail);
+        } catch (...) {
+            relocate(new_data, gap_pos, data_);
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        deallocate(data_, capacity_);
+        data_ = new_data;
+        capacity_ = new_capacity;
+        gap_start_ = gap_pos;
+        gap_end_ = new_capacity - tail;
+    }
+
+    size_t next_capacity(size_t required) const {
+        size_t new_capacity = Growth::next_capacity(capacity_, required, sizeof(T));
+        return new_capacity < required ? required : new_capacity;
+    }
+
+    // Освобождение своего буфера и перехват буфера other
+    void take_buffer(GapVector& other) noexcept {
+        clear();
+        deallocate(data_, capacity_);
+
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        gap_start_ = other.gap_start_;
+        gap_end_ = other.gap_end_;
+
+        other.data_ = nullptr;
+        other.capacity_ = 0;
+        other.gap_start_ = 0;
+        other.gap_end_ = 0;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    GapVector() : data_(nullptr), capacity_(0), gap_start_(0), gap_end_(0), alloc() {}
+
+    explicit GapVector(const Allocator& allocator)
+        : data_(nullptr), capacity_(0), gap_start_(0), gap_end_(0), alloc(allocator) {}
+
+    // Копирующий конструктор
+    GapVector(const GapVector& other)
+        : GapVector(other, AllocTraits::select_on_container_copy_construction(other.alloc)) {}
+
+    // Копирующий конструктор с заданным аллокатором: копия без разрыва
+    // внутри, вся свободная емкость - в конце
+    GapVector(const GapVector& other, const Allocator& allocator) : GapVector(allocator) {
+        reserve(other.size());
+        for (size_t i = 0; i < other.size(); ++i) {
+            emplace_back(*other.slot(i));
+        }
+    }
+
+    // Перемещающий конструктор
+    GapVector(GapVector&& other) noexcept
+        : data_(other.data_), capacity_(other.capacity_), gap_start_(other.gap_start_),
+          gap_end_(other.gap_end_), alloc(std::move(other.alloc)) {
+        other.data_ = nullptr;
+        other.capacity_ = 0;
+        other.gap_start_ = 0;
+        other.gap_end_ = 0;
+    }
+
+    // Копирующий оператор присваивания
+    GapVector& operator=(const GapVector& other) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                // Буфер, выделенный другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    clear();
+                    deallocate(data_, capacity_);
+                    data_ = nullptr;
+                    capacity_ = gap_start_ = gap_end_ = 0;
+                }
+                alloc = other.alloc;
+            }
+            // Текущий буфер переиспользуется, если его емкости хватает
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // Перемещающий оператор присваивания
+    GapVector& operator=(GapVector&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                                     AllocTraits::is_always_equal::value) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                clear();
+                deallocate(data_, capacity_);
+                data_ = nullptr;
+                capacity_ = gap_start_ = gap_end_ = 0;
+                alloc = std::move(other.alloc);
+                take_buffer(other);
+            } else if (alloc == other.alloc) {
+                take_buffer(other);
+            } else {
+                // Память другого аллокатора перехватить нельзя: перемещаем поэлементно
+                clear();
+                reserve(other.size());
+                for (size_t i = 0; i < other.size(); ++i) {
+                    emplace_back(std::move(*other.slot(i)));
+                }
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~GapVector() {
+        clear();
+        deallocate(data_, capacity_);
+    }
+
+    void swap(GapVector& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc, other.alloc);
+        }
+        std::swap(data_, other.data_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(gap_start_, other.gap_start_);
+        std::swap(gap_end_, other.gap_end_);
+    }
+
+    Allocator get_allocator() const {
+        return alloc;
+    }
+
+    // Методы доступа к элементам
+    T& operator[](size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return *slot(index);
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return *slot(index);
+    }
+
+    T& front() {
+        if (empty()) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return *slot(0);
+    }
+
+    const T& front() const {
+        return const_cast<GapVector&>(*this).front();
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return *slot(size() - 1);
+    }
+
+    const T& back() const {
+        return const_cast<GapVector&>(*this).back();
+    }
+
+    // Конструирование элемента на месте в позиции pos; разрыв остается сразу
+    // после нового элемента, так что следующая вставка в pos + 1 - O(1)
+    template<typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
+        if (pos > size()) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+
+        if (pos == gap_start_ && gap_start_ != gap_end_) {
+            construct(data_ + gap_start_, std::forward<Args>(args)...);
+            return data_[gap_start_++];
+        }
+
+        // Аргументы могут ссылаться на элементы, которые сейчас переедут
+        T tmp(std::forward<Args>(args)...);
+        if (gap_start_ == gap_end_) {
+            reallocate(next_capacity(size() + 1), pos);
+        } else {
+            shift_gap(pos);
+        }
+        construct(data_ + gap_start_, std::move(tmp));
+        return data_[gap_start_++];
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        return emplace(size(), std::forward<Args>(args)...);
+    }
+
+    void insert(size_t pos, const T& value) {
+        emplace(pos, value);
+    }
+
+    void insert(size_t pos, T&& value) {
+        emplace(pos, std::move(value));
+    }
+
+    void push_back(const T& value) {
+        emplace(size(), value);
+    }
+
+    void push_back(T&& value) {
+        emplace(size(), std::move(value));
+    }
+
+    void pop_back() {
+        if (empty()) {
+            throw std::out_of_range("Удаление из пустого вектора");
+        }
+        erase(size() - 1);
+    }
+
+    // Удаление элемента: разрыв переносится в pos и поглощает элемент
+    void erase(size_t pos) {
+        if (pos >= size()) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        shift_gap(pos);
+        destroy_one(data_ + gap_end_);
+        ++gap_end_;
+    }
+
+    // Удаление элементов с позициями [first, last)
+    void erase(size_t first, size_t last) {
+        if (first > last || last > size()) {
+            throw std::out_of_range("Диапазон удаления вне диапазона");
+        }
+        if (first == last) {
+            return;
+        }
+        shift_gap(first);
+        destroy(data_ + gap_end_, data_ + gap_end_ + (last - first));
+        gap_end_ += last - first;
+    }
+
+    // Замена содержимого элементами диапазона [first, last): живым элементам
+    // присваиваются новые значения, недостающие добавляются в конец, лишние
+    // поглощаются разрывом. Буфер меняется, только если емкости не хватает.
+    // Диапазон не должен указывать на элементы самого вектора.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        if constexpr (is_forward_iterator<InputIt>::value) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count > capacity_) {
+                // Старые элементы все равно заменяются: новый буфер без их переноса
+                clear();
+                reserve(count);
+            }
+        }
+        // Живые элементы лежат двумя кусками: до разрыва и после него
+        size_t i = 0;
+        for (T* p = data_; p != data_ + gap_start_ && first != last; ++p, ++first, ++i) {
+            assign_element(*p, *first);
+        }
+        for (T* p = data_ + gap_end_; p != data_ + capacity_ && first != last; ++p, ++first, ++i) {
+            assign_element(*p, *first);
+        }
+        erase(i, size());
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Позиция разрыва - индекс, вставка в который не сдвигает элементов
+    size_t gap_position() const {
+        return gap_start_;
+    }
+
+    // Перенос разрыва в позицию pos заранее (например, при перемещении курсора)
+    void move_gap(size_t pos) {
+        if (pos > size()) {
+            throw std::out_of_range("Позиция разрыва вне диапазона");
+        }
+        shift_gap(pos);
+    }
+
+    // Резервирование памяти минимум под new_capacity элементов (разрыв остается на месте)
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity, gap_start_);
+        }
+    }
+
+    // Освобождение неиспользуемой емкости
+    void shrink_to_fit() {
+        if (capacity_ > size()) {
+            if (empty()) {
+                deallocate(data_, capacity_);
+                data_ = nullptr;
+                capacity_ = gap_start_ = gap_end_ = 0;
+            } else {
+                reallocate(size(), gap_start_);
+            }
+        }
+    }
+
+    // Удаление всех элементов (емкость сохраняется, весь буфер - разрыв)
+    void clear() {
+        destroy(data_, data_ + gap_start_);
+        destroy(data_ + gap_end_, data_ + capacity_);
+        gap_start_ = 0;
+        gap_end_ = capacity_;
+    }
+
+    size_t size() const {
+        return capacity_ - gap_length();
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // Память, занимаемая вектором: сам объект и буфер емкостью capacity()
+    size_t memory_footprint() const {
+        return sizeof(*this) + capacity_ * sizeof(T);
+    }
+
+    // Счетчики политики статистики (для NoStats - пустой объект)
+    const Stats& stats() const {
+        return *this;
+    }
+
+    Stats& stats() {
+        return *this;
+    }
+
+    // Итератор произвольного доступа по индексу (разрыв при обходе пропускается);
+    // const_iterator дает доступ к элементам только на чтение
+    template<bool Const>
+    class basic_iterator {
+    private:
+        template<bool>
+        friend class basic_iterator;
+
+        using Owner = std::conditional_t<Const, const GapVector, GapVector>;
+
+        Owner* vec;    // Вектор, по которому идет обход
+        size_t index;  // Индекс текущего элемента
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : vec(nullptr), index(0) {}
+
+        basic_iterator(Owner* v, size_t i) : vec(v), index(i) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : vec(other.vec), index(other.index) {}
+
+        reference operator*() const {
+            return *vec->slot(index);
+        }
+
+        pointer operator->() const {
+            return vec->slot(index);
+        }
+
+        reference operator[](difference_type n) const {
+            return *vec->slot(index + n);
+        }
+
+        basic_iterator& operator++() {
+            ++index;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++index;
+            return temp;
+        }
+
+        basic_iterator& operator--() {
+            --index;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;
+            --index;
+            return temp;
+        }
+
+        basic_iterator& operator+=(difference_type n) {
+            index += n;
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type n) {
+            index -= n;
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return it += n;
+        }
+
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return it += n;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.index == b.index;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index != b.index;
+        }
+
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return a.index < b.index;
+        }
+
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return a.index > b.index;
+        }
+
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index <= b.index;
+        }
+
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index >= b.index;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, size());
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, size());
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+#include <cstddef>
+
+// Политики роста емкости Vector. Политика - класс со статическим методом
+//     size_t next_capacity(size_t capacity, size_t required, size_t element_size)
+// который получает текущую емкость, минимально необходимую емкость и размер
+// элемента в байтах. Если политика вернет меньше required, вектор все равно
+// выделит required элементов.
+
+// Удвоение: 0 -> 2 -> 4 -> 8 ... (по умолчанию)
+struct DoublingGrowth {
+    static size_t next_capacity(size_t capacity, size_t required, size_t) {
+        size_t grown = capacity == 0 ? 2 : capacity * 2;
+        return grown < required ? required : grown;
+    }
+};
+
+// Рост в 1.5 раза: меньше неиспользуемой памяти, и освобожденные ранее
+// буферы со временем могут быть переиспользованы аллокатором
+struct HalfGrowth {
+    static size_t next_capacity(size_t capacity, size_t required, size_t) {
+        size_t grown = capacity < 2 ? 2 : capacity + capacity / 2;
+        return grown < required ? required : grown;
+    }
+};
+
+// Рост в 1.5 раза с округлением размера буфера вверх до целого числа страниц.
+// Подходит для больших векторов, особенно вместе с MmapAllocator: буфер не
+// оставляет недоиспользованный хвост последней страницы.
+template<size_t PageSize = 4096>
+struct PageGrowth {
+    static_assert(PageSize != 0, "Размер страницы должен быть положительным");
+
+    static size_t next_capacity(size_t capacity, size_t required, size_t element_size) {
+        size_t grown = HalfGrowth::next_capacity(capacity, required, element_size);
+        size_t bytes = (grown * element_size + PageSize - 1) / PageSize * PageSize;
+        return bytes / element_size;
+    }
+};
+
+// Политика из пользовательской функции: size_t f(size_t capacity, size_t required)
+template<size_t (*Function)(size_t, size_t)>
+struct FunctionGrowth {
+    static size_t next_capacity(size_t capacity, size_t required, size_t) {
+        return Function(capacity, required);
+    }
+};
+
+#endif
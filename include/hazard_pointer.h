@@ -0,0 +1,140 @@
+#ifndef HAZARD_POINTER_H
+#define HAZARD_POINTER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Указатели опасности (hazard pointers) для безопасного освобождения узлов
+// lock-free структур. Поток, который собирается читать поля узла, публикует
+// его адрес в своей записи; удаленные из структуры узлы откладываются
+// (retire) и освобождаются только тогда, когда ни один поток их не защищает.
+// Пока узел защищен, его память не может быть переиспользована, поэтому
+// сравнение адресов в CAS не страдает от проблемы ABA.
+//
+// Записи общие для всех структур: у каждого потока одна запись, которая
+// выдается при первом обращении и возвращается при завершении потока.
+class HazardPointers {
+private:
+    struct alignas(64) Record {
+        std::atomic<const void*> pointer{nullptr};  // Защищаемый узел
+        std::atomic<bool> active{true};             // Запись занята потоком
+        Record* next = nullptr;                     // Следующая запись (записи не удаляются)
+    };
+
+    struct Retired {
+        void* pointer;               // Отложенный узел
+        void (*deleter)(void*);      // Функция освобождения
+    };
+
+    // Состояние потока: его запись и отложенные им узлы
+    struct ThreadState {
+        Record* record;
+        std::vector<Retired> retired;
+
+        ThreadState() : record(acquire_record()) {}
+
+        // Поток завершается: дожидаемся, пока отложенные узлы перестанут
+        // быть защищенными (указатели опасности держатся считанные инструкции)
+        ~ThreadState() {
+            record->pointer.store(nullptr, std::memory_order_release);
+            scan(*this);
+            while (!retired.empty()) {
+                std::this_thread::yield();
+                scan(*this);
+            }
+            record->active.store(false, std::memory_order_release);
+        }
+    };
+
+    static std::atomic<Record*>& records() {
+        static std::atomic<Record*> head{nullptr};
+        return head;
+    }
+
+    static std::atomic<size_t>& record_count() {
+        static std::atomic<size_t> count{0};
+        return count;
+    }
+
+    // Занять свободную запись или добавить новую в начало списка записей
+    static Record* acquire_record() {
+        for (Record* r = records().load(std::memory_order_acquire); r; r = r->next) {
+            bool expected = false;
+            if (!r->active.load(std::memory_order_relaxed) &&
+                r->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return r;
+            }
+        }
+        Record* r = new Record;
+        r->next = records().load(std::memory_order_relaxed);
+        while (!records().compare_exchange_weak(r->next, r, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        record_count().fetch_add(1, std::memory_order_relaxed);
+        return r;
+    }
+
+    static ThreadState& state() {
+        thread_local ThreadState s;
+        return s;
+    }
+
+    // Освобождение отложенных узлов, которые не защищены ни одним потоком
+    static void scan(ThreadState& s) {
+        std::vector<const void*> hazards;
+        for (Record* r = records().load(std::memory_order_acquire); r; r = r->next) {
+            if (const void* p = r->pointer.load(std::memory_order_seq_cst)) {
+                hazards.push_back(p);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        std::vector<Retired> kept;
+        for (const Retired& item : s.retired) {
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(item.pointer))) {
+                kept.push_back(item);
+            } else {
+                item.deleter(item.pointer);
+            }
+        }
+        s.retired.swap(kept);
+    }
+
+public:
+    // Защита узла, на который указывает source: публикует адрес и
+    // перепроверяет, что source все еще указывает на него.
+    // Возвращает защищенный указатель (или nullptr).
+    template<typename Node>
+    static Node* protect(const std::atomic<Node*>& source) {
+        std::atomic<const void*>& hazard = state().record->pointer;
+        Node* p = source.load(std::memory_order_relaxed);
+        while (true) {
+            hazard.store(p, std::memory_order_seq_cst);
+            Node* current = source.load(std::memory_order_seq_cst);
+            if (current == p) {
+                return p;
+            }
+            p = current;
+        }
+    }
+
+    // Снятие защиты текущего потока
+    static void clear() {
+        state().record->pointer.store(nullptr, std::memory_order_release);
+    }
+
+    // Отложенное освобождение узла, уже исключенного из структуры.
+    // Проверка защит выполняется пачками, поэтому в среднем retire - O(1).
+    template<typename Node>
+    static void retire(Node* node) {
+        ThreadState& s = state();
+        s.retired.push_back(Retired{node, [](void* p) { delete static_cast<Node*>(p); }});
+        if (s.retired.size() >= 2 * record_count().load(std::memory_order_relaxed) + 64) {
+            scan(s);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,635 @@
+#ifndef INCREMENTAL_VECTOR_H
+#define INCREMENTAL_VECTOR_H
+
+#include "vector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Вектор с постепенным (неамортизированным) перевыделением. Когда буфер
+// заполнен, выделяется буфер вдвое больше, но элементы не переносятся
+// сразу: старый буфер сохраняется, и каждая следующая вставка в конец
+// переносит в новый буфер постоянное число элементов. Перенос гарантированно
+// заканчивается раньше, чем заполнится новый буфер, поэтому push_back
+// работает за O(1) в худшем случае, а не только в среднем.
+//
+// Пока идет перенос, элемент с индексом i лежит в старом буфере, если
+// migrated <= i < old_end, и в новом - иначе. Чтение не переносит элементы,
+// поэтому ссылки остаются действительными до следующей модификации.
+template<typename T, typename Allocator = std::allocator<T>>
+class IncrementalVector {
+private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    T* data;              // Текущий буфер (при переносе - новый)
+    size_t size_;         // Количество элементов
+    size_t capacity_;     // Емкость текущего буфера
+    T* old_data;          // Старый буфер, из которого идет перенос (nullptr - переноса нет)
+    size_t old_capacity;  // Емкость старого буфера
+    size_t migrated;      // Элементы [0, migrated) уже перенесены в новый буфер
+    size_t old_end;       // Элементы [migrated, old_end) еще в старом буфере
+    Allocator alloc;      // Аллокатор буферов
+
+    static constexpr bool relocatable = is_trivially_relocatable<T>::value;
+
+    // Элементов, переносимых за одну вставку: для побайтово переносимых
+    // мелких типов - кэш-линия, для остальных - два элемента. При росте
+    // вдвое и переносе хотя бы двух элементов за вставку перенос заканчивается
+    // не позже, чем новый буфер заполнится наполовину.
+    static constexpr size_t migration_step = relocatable && sizeof(T) <= 32 ? 64 / sizeof(T) : 2;
+
+    T* allocate(size_t n) {
+        return n == 0 ? nullptr : AllocTraits::allocate(alloc, n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (p) {
+            AllocTraits::deallocate(alloc, p, n);
+        }
+    }
+
+    template<typename... Args>
+    void construct(T* p, Args&&... args) {
+        AllocTraits::construct(alloc, p, std::forward<Args>(args)...);
+    }
+
+    void destroy_one(T* p) {
+        AllocTraits::destroy(alloc, p);
+    }
+
+    bool migrating() const {
+        return old_data != nullptr;
+    }
+
+    // Адрес ячейки элемента с индексом index (в старом или новом буфере)
+    T* slot(size_t index) const {
+        if (migrating() && index >= migrated && index < old_end) {
+            return old_data + index;
+        }
+        return data + index;
+    }
+
+    // Освобождение старого буфера после окончания переноса
+    void release_old() {
+        deallocate(old_data, old_capacity);
+        old_data = nullptr;
+        old_capacity = 0;
+        migrated = 0;
+        old_end = 0;
+    }
+
+    // Перенос до count элементов из старого буфера в новый.
+    // Если перемещение бросит исключение, перенесенная часть остается
+    // в новом буфере, а остальные элементы - в старом.
+    void migrate(size_t count) {
+        size_t stop = std::min(old_end, migrated + count);
+        if constexpr (relocatable) {
+            std::memcpy(static_cast<void*>(data + migrated), static_cast<const void*>(old_data + migrated),
+                        (stop - migrated) * sizeof(T));
+            migrated = stop;
+        } else {
+            for (; migrated < stop; ++migrated) {
+                construct(data + migrated, std::move_if_noexcept(old_data[migrated]));
+                destroy_one(old_data + migrated);
+            }
+        }
+        if (migrated == old_end) {
+            release_old();
+        }
+    }
+
+    // Немедленный перенос всех элементов в новый буфер емкостью new_capacity
+    void reallocate(size_t new_capacity) {
+        complete_migration();
+        T* new_data = allocate(new_capacity);
+        if constexpr (relocatable) {
+            if (size_ != 0) {
+                std::memcpy(static_cast<void*>(new_data), static_cast<const void*>(data), size_ * sizeof(T));
+            }
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < size_; ++i) {
+                    construct(new_data + i, std::move_if_noexcept(data[i]));
+                }
+            } catch (...) {
+                for (size_t j = 0; j < i; ++j) {
+                    destroy_one(new_data + j);
+                }
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            for (size_t j = 0; j < size_; ++j) {
+                destroy_one(data + j);
+            }
+        }
+        deallocate(data, capacity_);
+        data = new_data;
+        capacity_ = new_capacity;
+    }
+
+    // Уничтожение элементов и освобождение обоих буферов
+    void release_buffers() {
+        clear();
+        deallocate(data, capacity_);
+        data = nullptr;
+        capacity_ = 0;
+    }
+
+    // Перехват всех буферов other; текущий объект должен быть пустым и без буферов
+    void take(IncrementalVector& other) noexcept {
+        data = other.data;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        old_data = other.old_data;
+        old_capacity = other.old_capacity;
+        migrated = other.migrated;
+        old_end = other.old_end;
+
+        other.data = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        other.old_data = nullptr;
+        other.old_capacity = 0;
+        other.migrated = 0;
+        other.old_end = 0;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    IncrementalVector()
+        : data(nullptr), size_(0), capacity_(0), old_data(nullptr), old_capacity(0), migrated(0), old_end(0),
+          alloc() {}
+
+    explicit IncrementalVector(const Allocator& allocator)
+        : data(nullptr), size_(0), capacity_(0), old_data(nullptr), old_capacity(0), migrated(0), old_end(0),
+          alloc(allocator) {}
+
+    // Копирующий конструктор: копия строится сразу в одном буфере
+    IncrementalVector(const IncrementalVector& other)
+        : IncrementalVector(AllocTraits::select_on_container_copy_construction(other.alloc)) {
+        reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            emplace_back(*other.slot(i));
+        }
+    }
+
+    IncrementalVector(IncrementalVector&& other) noexcept : IncrementalVector(std::move(other.alloc)) {
+        take(other);
+    }
+
+    // Копирующий оператор присваивания: текущий буфер переиспользуется,
+    // если его емкости хватает
+    IncrementalVector& operator=(const IncrementalVector& other) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                // Буфер, выделенный другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    release_buffers();
+                }
+                alloc = other.alloc;
+            }
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // Перемещающий оператор присваивания
+    IncrementalVector& operator=(IncrementalVector&& other) noexcept(
+        AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value) {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                release_buffers();
+                alloc = std::move(other.alloc);
+                take(other);
+            } else if (alloc == other.alloc) {
+                release_buffers();
+                take(other);
+            } else {
+                // Память другого аллокатора перехватить нельзя: перемещаем поэлементно
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    ~IncrementalVector() {
+        release_buffers();
+    }
+
+    // Обмен содержимым; аллокаторы обмениваются по propagate_on_container_swap
+    void swap(IncrementalVector& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc, other.alloc);
+        }
+        std::swap(data, other.data);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(old_data, other.old_data);
+        std::swap(old_capacity, other.old_capacity);
+        std::swap(migrated, other.migrated);
+        std::swap(old_end, other.old_end);
+    }
+
+    Allocator get_allocator() const {
+        return alloc;
+    }
+
+    // Методы доступа к элементам
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return *slot(index);
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return *slot(index);
+    }
+
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return *slot(0);
+    }
+
+    const T& front() const {
+        return const_cast<IncrementalVector&>(*this).front();
+    }
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return *slot(size_ - 1);
+    }
+
+    const T& back() const {
+        return const_cast<IncrementalVector&>(*this).back();
+    }
+
+    // Конструирование элемента на месте в конце за O(1) в худшем случае
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            // К этому моменту предыдущий перенос уже закончен
+            complete_migration();
+            size_t new_capacity = capacity_ == 0 ? 2 : capacity_ * 2;
+            T* new_data = allocate(new_capacity);
+            try {
+                // Старые элементы еще на месте, поэтому аргументы могут на них ссылаться
+                construct(new_data + size_, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            if (size_ != 0) {
+                // Старый буфер остается источником для постепенного переноса
+                old_data = data;
+                old_capacity = capacity_;
+                migrated = 0;
+                old_end = size_;
+            }
+            data = new_data;
+            capacity_ = new_capacity;
+            return data[size_++];
+        }
+
+        construct(data + size_, std::forward<Args>(args)...);
+        ++size_;
+        if (migrating()) {
+            try {
+                migrate(migration_step);
+            } catch (...) {
+                --size_;
+                destroy_one(data + size_);
+                throw;
+            }
+        }
+        return data[size_ - 1];
+    }
+
+    // Добавление элемента в конец (для l-value)
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    // Добавление элемента в конец (для r-value - с перемещением)
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Удаление последнего элемента
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого вектора");
+        }
+        --size_;
+        destroy_one(slot(size_));
+        if (migrating() && size_ < old_end) {
+            // Удален элемент из старого буфера: переносить осталось меньше
+            old_end = size_;
+            if (migrated == old_end) {
+                release_old();
+            }
+        }
+    }
+
+    // Конструирование элемента в произвольной позиции. Вставка в середину
+    // и так требует O(n), поэтому перед сдвигом перенос завершается сразу.
+    template<typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        if (pos == size_) {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+
+        T tmp(std::forward<Args>(args)...);
+        complete_migration();
+        if (size_ == capacity_) {
+            reallocate(capacity_ * 2);
+        }
+        if constexpr (relocatable) {
+            std::memmove(static_cast<void*>(data + pos + 1), static_cast<const void*>(data + pos),
+                         (size_ - pos) * sizeof(T));
+            construct(data + pos, std::move(tmp));
+        } else {
+            construct(data + size_, std::move(data[size_ - 1]));
+            for (size_t i = size_ - 1; i > pos; --i) {
+                data[i] = std::move(data[i - 1]);
+            }
+            data[pos] = std::move(tmp);
+        }
+        ++size_;
+        return data[pos];
+    }
+
+    // Вставка элемента в произвольную позицию (для l-value)
+    void insert(size_t pos, const T& value) {
+        emplace(pos, value);
+    }
+
+    // Вставка элемента в произвольную позицию (для r-value)
+    void insert(size_t pos, T&& value) {
+        emplace(pos, std::move(value));
+    }
+
+    // Удаление элемента по позиции (перенос завершается сразу)
+    void erase(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        complete_migration();
+        if constexpr (relocatable) {
+            destroy_one(data + pos);
+            std::memmove(static_cast<void*>(data + pos), static_cast<const void*>(data + pos + 1),
+                         (size_ - pos - 1) * sizeof(T));
+        } else {
+            for (size_t i = pos; i < size_ - 1; ++i) {
+                data[i] = std::move(data[i + 1]);
+            }
+            destroy_one(data + size_ - 1);
+        }
+        --size_;
+    }
+
+    // Завершение текущего переноса за O(n)
+    void complete_migration() {
+        if (migrating()) {
+            migrate(old_end - migrated);
+        }
+    }
+
+    // Идет ли сейчас перенос из старого буфера
+    bool is_migrating() const {
+        return migrating();
+    }
+
+    // Замена содержимого элементами диапазона [first, last). Незаконченный
+    // перенос завершается, затем живым элементам присваиваются новые
+    // значения, недостающие конструируются за ними, лишние уничтожаются.
+    // Для прямых итераторов буфер меняется, только если емкости не хватает.
+    // Диапазон не должен указывать на элементы самого вектора.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        complete_migration();
+        if constexpr (is_forward_iterator<InputIt>::value) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count > capacity_) {
+                // Старые элементы все равно заменяются: новый буфер без их переноса
+                clear();
+                reallocate(count);
+            }
+        }
+        size_t i = 0;
+        for (; i < size_ && first != last; ++i, ++first) {
+            data[i] = *first;
+        }
+        while (size_ > i) {
+            destroy_one(data + --size_);
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Резервирование памяти: перенос выполняется сразу, за O(n)
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Удаление всех элементов (емкость нового буфера сохраняется)
+    void clear() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < size_; ++i) {
+                destroy_one(slot(i));
+            }
+        }
+        if (migrating()) {
+            release_old();
+        }
+        size_ = 0;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    // Емкость текущего буфера
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Память, занимаемая вектором: сам объект и оба буфера на время переноса
+    size_t memory_footprint() const {
+        return sizeof(*this) + (capacity_ + old_capacity) * sizeof(T);
+    }
+
+    // Итератор произвольного доступа по индексу: адрес элемента находится
+    // при разыменовании, поэтому перенос элементов между буферами итератор
+    // не портит
+    template<bool Const>
+    class basic_iterator {
+    private:
+        template<bool>
+        friend class basic_iterator;
+
+        using Owner = std::conditional_t<Const, const IncrementalVector, IncrementalVector>;
+
+        Owner* vec;    // Вектор, по которому идет обход
+        size_t index;  // Индекс текущего элемента
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : vec(nullptr), index(0) {}
+
+        basic_iterator(Owner* v, size_t i) : vec(v), index(i) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : vec(other.vec), index(other.index) {}
+
+        reference operator*() const {
+            return *vec->slot(index);
+        }
+
+        pointer operator->() const {
+            return vec->slot(index);
+        }
+
+        reference operator[](difference_type n) const {
+            return *vec->slot(index + n);
+        }
+
+        basic_iterator& operator++() {
+            ++index;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++index;
+            return temp;
+        }
+
+        basic_iterator& operator--() {
+            --index;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;
+            --index;
+            return temp;
+        }
+
+        basic_iterator& operator+=(difference_type n) {
+            index += n;
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type n) {
+            index -= n;
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return it += n;
+        }
+
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return it += n;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.index == b.index && a.vec == b.vec;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return !(a == b);
+        }
+
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return a.index < b.index;
+        }
+
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return a.index > b.index;
+        }
+
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index <= b.index;
+        }
+
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return a.index >= b.index;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, size_);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef INDEX_SET_H
+#define INDEX_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// Набор позиций для erase_indices у Vector, List и ForwardList: индексы из
+// [first, last) в порядке возрастания, без повторов. Уже упорядоченный
+// диапазон только копируется. Редкий набор сортируется за O(k log k), а
+// плотный (больше size / 16 индексов) раскладывается по битовой шкале за
+// O(size + k), что на удалении заметной доли элементов быстрее сортировки.
+// Индекс вне [0, size) - std::out_of_range до каких-либо изменений контейнера.
+template<typename InputIt>
+std::vector<size_t> sorted_index_set(InputIt first, InputIt last, size_t size) {
+    std::vector<size_t> indices(first, last);
+    if (std::is_sorted(indices.begin(), indices.end())) {
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    } else if (indices.size() > size / 16) {
+        std::vector<bool> marked(size);
+        for (size_t index : indices) {
+            if (index >= size) {
+                throw std::out_of_range("Позиция удаления вне диапазона");
+            }
+            marked[index] = true;
+        }
+        indices.clear();
+        for (size_t i = 0; i < size; ++i) {
+            if (marked[i]) {
+                indices.push_back(i);
+            }
+        }
+    } else {
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    }
+    if (!indices.empty() && indices.back() >= size) {
+        throw std::out_of_range("Позиция удаления вне диапазона");
+    }
+    return indices;
+}
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef INTRUSIVE_FORWARD_LIST_H
+#define INTRUSIVE_FORWARD_LIST_H
+
+#include "intrusive_hook.h"
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Встраиваемый однонаправленный список: связи хранятся в поле-крючке
+// ForwardListHook самих объектов (см. intrusive_hook.h и IntrusiveList).
+// Список не выделяет память и не копирует объекты. Вставка в начало, в
+// конец и после позиции, удаление после позиции и splice_after - O(1).
+// Удаление объекта по ссылке - O(n): предшественника приходится искать
+// проходом от начала (для O(1) нужен IntrusiveList).
+//
+// SafeMode - проверка, что вставляемый объект еще не связан через этот
+// крючок, а удаляемый - связан (std::invalid_argument вместо порчи списков).
+template<typename T, ForwardListHook T::*Hook, bool SafeMode = false>
+class IntrusiveForwardList {
+private:
+    using Owner = HookOwner<T, ForwardListHook, Hook>;
+
+    ForwardListHook before_head;  // Фиктивный крючок: before_head.next - первый объект
+    ForwardListHook* tail;        // Последний крючок (или &before_head, если список пуст)
+    size_t size_;                 // Количество объектов в списке
+
+    static void check_unlinked(const ForwardListHook* hook) {
+        if constexpr (SafeMode) {
+            if (hook->is_linked()) {
+                throw std::invalid_argument("Объект уже находится в списке");
+            }
+        }
+    }
+
+    static void check_linked(const ForwardListHook* hook) {
+        if constexpr (SafeMode) {
+            if (!hook->is_linked()) {
+                throw std::invalid_argument("Объект не находится в списке");
+            }
+        }
+    }
+
+    // Вставка крючка после pos
+    void link_after(ForwardListHook* pos, ForwardListHook* hook) {
+        check_unlinked(hook);
+        hook->next = pos->next;
+        pos->next = hook;
+        if (pos == tail) {
+            tail = hook;
+        }
+        ++size_;
+    }
+
+    // Удаление крючка, следующего за pos; крючок снова несвязан
+    void unlink_after(ForwardListHook* pos) {
+        ForwardListHook* hook = pos->next;
+        pos->next = hook->next;
+        if (hook == tail) {
+            tail = pos;
+        }
+        hook->next = hook;
+        --size_;
+    }
+
+    void reset() {
+        before_head.next = nullptr;
+        tail = &before_head;
+        size_ = 0;
+    }
+
+    // Перехват объектов другого списка (текущий список должен быть пуст)
+    void take_hooks(IntrusiveForwardList& other) {
+        before_head.next = other.before_head.next;
+        tail = other.size_ ? other.tail : &before_head;
+        size_ = other.size_;
+        other.reset();
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    IntrusiveForwardList() {
+        reset();
+    }
+
+    // Объект может состоять только в одном списке через данный крючок
+    IntrusiveForwardList(const IntrusiveForwardList&) = delete;
+    IntrusiveForwardList& operator=(const IntrusiveForwardList&) = delete;
+
+    IntrusiveForwardList(IntrusiveForwardList&& other) noexcept {
+        take_hooks(other);
+    }
+
+    IntrusiveForwardList& operator=(IntrusiveForwardList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            take_hooks(other);
+        }
+        return *this;
+    }
+
+    // Объекты остаются жить, их крючки становятся несвязанными
+    ~IntrusiveForwardList() {
+        clear();
+    }
+
+    // Отвязывание всех объектов за O(n)
+    void clear() {
+        ForwardListHook* current = before_head.next;
+        while (current) {
+            ForwardListHook* next = current->next;
+            current->next = current;
+            current = next;
+        }
+        reset();
+    }
+
+    void swap(IntrusiveForwardList& other) noexcept {
+        IntrusiveForwardList temp(std::move(other));
+        other.take_hooks(*this);
+        take_hooks(temp);
+    }
+
+    void push_front(T& object) {
+        link_after(&before_head, Owner::hook(object));
+    }
+
+    void push_back(T& object) {
+        link_after(tail, Owner::hook(object));
+    }
+
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return *Owner::owner(before_head.next);
+    }
+
+    const T& front() const {
+        return const_cast<IntrusiveForwardList&>(*this).front();
+    }
+
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        unlink_after(&before_head);
+    }
+
+    // Удаление объекта из списка по ссылке за O(n). Возвращает false, если
+    // объекта в списке нет (в безопасном режиме несвязанный объект - ошибка).
+    bool unlink(T& object) {
+        ForwardListHook* hook = Owner::hook(object);
+        check_linked(hook);
+        for (ForwardListHook* pos = &before_head; pos->next; pos = pos->next) {
+            if (pos->next == hook) {
+                unlink_after(pos);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Однонаправленный итератор по объектам списка;
+    // const_iterator дает доступ к объектам только на чтение
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class IntrusiveForwardList;
+        template<bool>
+        friend class basic_iterator;
+
+        ForwardListHook* current;  // Крючок текущего объекта (nullptr - конец списка)
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : current(nullptr) {}
+
+        explicit basic_iterator(ForwardListHook* hook) : current(hook) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : current(other.current) {}
+
+        reference operator*() const {
+            return *Owner::owner(current);
+        }
+
+        pointer operator->() const {
+            return Owner::owner(current);
+        }
+
+        basic_iterator& operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            current = current->next;
+            return temp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.current == b.current;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.current != b.current;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // Итератор на фиктивную позицию перед первым объектом (для insert_after/erase_after)
+    iterator before_begin() {
+        return iterator(&before_head);
+    }
+
+    iterator begin() {
+        return iterator(before_head.next);
+    }
+
+    iterator end() {
+        return iterator(nullptr);
+    }
+
+    const_iterator before_begin() const {
+        return const_iterator(const_cast<ForwardListHook*>(&before_head));
+    }
+
+    const_iterator begin() const {
+        return const_iterator(before_head.next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // Итератор на объект, состоящий в списке, за O(1)
+    iterator iterator_to(T& object) {
+        return iterator(Owner::hook(object));
+    }
+
+    // Вставка объекта после pos за O(1). Возвращает итератор на вставленный объект.
+    iterator insert_after(iterator pos, T& object) {
+        if (!pos.current) {
+            throw std::out_of_range("Недопустимая позиция для вставки");
+        }
+        ForwardListHook* hook = Owner::hook(object);
+        link_after(pos.current, hook);
+        return iterator(hook);
+    }
+
+    // Удаление объекта, следующего за pos, за O(1). Возвращает итератор на следующий за удаленным.
+    iterator erase_after(iterator pos) {
+        if (!pos.current || !pos.current->next) {
+            throw std::out_of_range("Недопустимая позиция для удаления");
+        }
+        unlink_after(pos.current);
+        return iterator(pos.current->next);
+    }
+
+    // Перенос всех объектов other после pos за O(1)
+    void splice_after(iterator pos, IntrusiveForwardList& other) {
+        if (this == &other || other.size_ == 0) {
+            return;
+        }
+        if (!pos.current) {
+            throw std::out_of_range("Недопустимая позиция для вставки");
+        }
+        ForwardListHook* first = other.before_head.next;
+        ForwardListHook* last = other.tail;
+        last->next = pos.current->next;
+        pos.current->next = first;
+        if (pos.current == tail) {
+            tail = last;
+        }
+        size_ += other.size_;
+        other.reset();
+    }
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef INTRUSIVE_HOOK_H
+#define INTRUSIVE_HOOK_H
+
+#include <cstddef>
+
+// Крючки (hooks) для встраиваемых списков IntrusiveList и IntrusiveForwardList.
+// Объект сам хранит связи списка в поле-крючке, поэтому список не выделяет
+// узлов и не копирует элементы: вставка и удаление только перевязывают
+// указатели. Объект может одновременно состоять в нескольких списках, если у
+// него несколько крючков.
+//
+// Копия объекта не наследует связи оригинала: копирование крючка дает
+// несвязанный крючок, присваивание крючок не меняет. При удалении из списка
+// крючок снова становится несвязанным, поэтому is_linked() всегда достоверен.
+
+// Крючок двунаправленного списка. Несвязанный крючок - оба указателя nullptr.
+struct ListHook {
+    ListHook* prev;  // Предыдущий крючок в списке
+    ListHook* next;  // Следующий крючок в списке
+
+    ListHook() noexcept : prev(nullptr), next(nullptr) {}
+
+    ListHook(const ListHook&) noexcept : prev(nullptr), next(nullptr) {}
+
+    ListHook& operator=(const ListHook&) noexcept {
+        return *this;
+    }
+
+    bool is_linked() const noexcept {
+        return next != nullptr;
+    }
+};
+
+// Крючок однонаправленного списка. Последний крючок списка указывает на
+// nullptr, поэтому несвязанный крючок указывает сам на себя.
+struct ForwardListHook {
+    ForwardListHook* next;  // Следующий крючок в списке
+
+    ForwardListHook() noexcept : next(this) {}
+
+    ForwardListHook(const ForwardListHook&) noexcept : next(this) {}
+
+    ForwardListHook& operator=(const ForwardListHook&) noexcept {
+        return *this;
+    }
+
+    bool is_linked() const noexcept {
+        return next != this;
+    }
+};
+
+// Переход от крючка к объекту, в который он встроен: Member - указатель на
+// поле-крючок типа Hook в T
+template<typename T, typename Hook, Hook T::*Member>
+struct HookOwner {
+    // Смещение крючка от начала объекта. Вычисляется на памяти подходящего
+    // размера и выравнивания без создания объекта; компилятор сворачивает
+    // его в константу.
+    static size_t offset() noexcept {
+        alignas(T) static char probe[sizeof(T)];
+        const T* object = reinterpret_cast<const T*>(probe);
+        return static_cast<size_t>(reinterpret_cast<const char*>(&(object->*Member)) - probe);
+    }
+
+    static T* owner(Hook* hook) noexcept {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - offset());
+    }
+
+    static Hook* hook(T& object) noexcept {
+        return &(object.*Member);
+    }
+};
+
+#endif
@@ -0,0 +1,356 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include "intrusive_hook.h"
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Встраиваемый двунаправленный список: связи хранятся в поле-крючке ListHook
+// самих объектов (см. intrusive_hook.h), например
+//
+//     struct Task {
+//         int id;
+//         ListHook hook;
+//     };
+//     IntrusiveList<Task, &Task::hook> queue;
+//
+// Список не владеет объектами: не выделяет память, не копирует, не
+// перемещает и не уничтожает их. Объект должен жить дольше, чем состоит в
+// списке, и не должен перемещаться в памяти, пока связан. Все операции,
+// кроме clear() и деструктора, - O(1), включая удаление объекта по ссылке.
+//
+// SafeMode - проверка, что вставляемый объект еще не связан через этот
+// крючок, а удаляемый - связан (std::invalid_argument вместо порчи списков).
+template<typename T, ListHook T::*Hook, bool SafeMode = false>
+class IntrusiveList {
+private:
+    using Owner = HookOwner<T, ListHook, Hook>;
+
+    ListHook sentinel;  // Фиктивный крючок: sentinel.next - первый объект, sentinel.prev - последний
+    size_t size_;       // Количество объектов в списке
+
+    static void check_unlinked(const ListHook* hook) {
+        if constexpr (SafeMode) {
+            if (hook->is_linked()) {
+                throw std::invalid_argument("Объект уже находится в списке");
+            }
+        }
+    }
+
+    static void check_linked(const ListHook* hook) {
+        if constexpr (SafeMode) {
+            if (!hook->is_linked()) {
+                throw std::invalid_argument("Объект не находится в списке");
+            }
+        }
+    }
+
+    // Вставка крючка перед pos
+    void link_before(ListHook* pos, ListHook* hook) {
+        check_unlinked(hook);
+        hook->prev = pos->prev;
+        hook->next = pos;
+        pos->prev->next = hook;
+        pos->prev = hook;
+        ++size_;
+    }
+
+    // Удаление крючка из списка; крючок снова несвязан. Возвращает следующий крючок.
+    ListHook* unlink_hook(ListHook* hook) {
+        ListHook* next = hook->next;
+        hook->prev->next = next;
+        next->prev = hook->prev;
+        hook->prev = hook->next = nullptr;
+        --size_;
+        return next;
+    }
+
+    // Перевязка цепочки [first, last] из одного кольца перед pos в другом (размеры не меняются)
+    static void move_range_before(ListHook* pos, ListHook* first, ListHook* last) {
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+        first->prev = pos->prev;
+        last->next = pos;
+        pos->prev->next = first;
+        pos->prev = last;
+    }
+
+    void reset() {
+        sentinel.prev = sentinel.next = &sentinel;
+        size_ = 0;
+    }
+
+    // Перехват объектов другого списка (текущий список должен быть пуст)
+    void take_hooks(IntrusiveList& other) {
+        if (other.size_ == 0) {
+            reset();
+            return;
+        }
+        sentinel.next = other.sentinel.next;
+        sentinel.prev = other.sentinel.prev;
+        sentinel.next->prev = &sentinel;
+        sentinel.prev->next = &sentinel;
+        size_ = other.size_;
+        other.reset();
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    IntrusiveList() {
+        reset();
+    }
+
+    // Объект может состоять только в одном списке через данный крючок
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept {
+        take_hooks(other);
+    }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            take_hooks(other);
+        }
+        return *this;
+    }
+
+    // Объекты остаются жить, их крючки становятся несвязанными
+    ~IntrusiveList() {
+        clear();
+    }
+
+    // Отвязывание всех объектов за O(n)
+    void clear() {
+        ListHook* current = sentinel.next;
+        while (current != &sentinel) {
+            ListHook* next = current->next;
+            current->prev = current->next = nullptr;
+            current = next;
+        }
+        reset();
+    }
+
+    void swap(IntrusiveList& other) noexcept {
+        IntrusiveList temp(std::move(other));
+        other.take_hooks(*this);
+        take_hooks(temp);
+    }
+
+    void push_back(T& object) {
+        link_before(&sentinel, Owner::hook(object));
+    }
+
+    void push_front(T& object) {
+        link_before(sentinel.next, Owner::hook(object));
+    }
+
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return *Owner::owner(sentinel.next);
+    }
+
+    const T& front() const {
+        return const_cast<IntrusiveList&>(*this).front();
+    }
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return *Owner::owner(sentinel.prev);
+    }
+
+    const T& back() const {
+        return const_cast<IntrusiveList&>(*this).back();
+    }
+
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        unlink_hook(sentinel.prev);
+    }
+
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        unlink_hook(sentinel.next);
+    }
+
+    // Удаление объекта из списка по ссылке за O(1). Объект должен состоять
+    // именно в этом списке (безопасный режим проверяет только, что он связан).
+    void unlink(T& object) {
+        ListHook* hook = Owner::hook(object);
+        check_linked(hook);
+        unlink_hook(hook);
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Двунаправленный итератор по объектам списка;
+    // const_iterator дает доступ к объектам только на чтение
+    template<bool Const>
+    class basic_iterator {
+    private:
+        friend class IntrusiveList;
+        template<bool>
+        friend class basic_iterator;
+
+        ListHook* current;  // Крючок текущего объекта
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : current(nullptr) {}
+
+        explicit basic_iterator(ListHook* hook) : current(hook) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : current(other.current) {}
+
+        reference operator*() const {
+            return *Owner::owner(current);
+        }
+
+        pointer operator->() const {
+            return Owner::owner(current);
+        }
+
+        basic_iterator& operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            current = current->next;
+            return temp;
+        }
+
+        basic_iterator& operator--() {
+            current = current->prev;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;
+            current = current->prev;
+            return temp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.current == b.current;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.current != b.current;
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() {
+        return iterator(sentinel.next);
+    }
+
+    iterator end() {
+        return iterator(&sentinel);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(sentinel.next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(const_cast<ListHook*>(&sentinel));
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // Итератор на объект, состоящий в списке, за O(1)
+    iterator iterator_to(T& object) {
+        return iterator(Owner::hook(object));
+    }
+
+    const_iterator iterator_to(const T& object) const {
+        return const_iterator(Owner::hook(const_cast<T&>(object)));
+    }
+
+    // Вставка объекта перед pos за O(1). Возвращает итератор на вставленный объект.
+    iterator insert(iterator pos, T& object) {
+        ListHook* hook = Owner::hook(object);
+        link_before(pos.current, hook);
+        return iterator(hook);
+    }
+
+    // Удаление объекта по итератору за O(1). Возвращает итератор на следующий объект.
+    iterator erase(iterator pos) {
+        if (pos.current == &sentinel) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        return iterator(unlink_hook(pos.current));
+    }
+
+    // Удаление объектов в диапазоне [first, last). Возвращает last.
+    iterator erase(iterator first, iterator last) {
+        while (first != last) {
+            first = erase(first);
+        }
+        return last;
+    }
+
+    // Перенос всех объектов other перед pos за O(1)
+    void splice(iterator pos, IntrusiveList& other) {
+        if (this == &other || other.size_ == 0) {
+            return;
+        }
+        move_range_before(pos.current, other.sentinel.next, other.sentinel.prev);
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    // Перенос одного объекта it из other перед pos за O(1)
+    void splice(iterator pos, IntrusiveList& other, iterator it) {
+        ListHook* hook = it.current;
+        if (hook == pos.current || hook->next == pos.current) {
+            return;  // Объект уже стоит на нужном месте
+        }
+        move_range_before(pos.current, hook, hook);
+        --other.size_;
+        ++size_;
+    }
+};
+
+#endif
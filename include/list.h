@@ -1,330 +1,983 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include "container_stats.h"
+#include "index_set.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
-template<typename T>
-class List {
+// Stats - политика статистики (NoStats или ContainerStats, см. container_stats.h)
+template<typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats>
+class List : private Stats {
 private:
-    struct Node {
+    // Часть узла со связями. Из нее же состоит фиктивный узел sentinel,
+    // замыкающий список в кольцо: sentinel.next - первый узел, sentinel.prev - последний
+    struct NodeBase {
+        NodeBase* prev;     // Указатель на предыдущий узел
+        NodeBase* next;     // Указатель на следующий узел
+
+        NodeBase() : prev(this), next(this) {}
+    };
+
+    struct Node : NodeBase {
         T data;         // Данные, хранящиеся в узле
-        Node* prev;     // Указатель на предыдущий узел 
-        Node* next;     // Указатель на следующий узел
-        
+
         // Конструктор для l-value ссылок (обычных объектов)
-        Node(const T& value) : data(value), prev(nullptr), next(nullptr) {}
-        
+        Node(const T& value) : data(value) {}
+
         // Конструктор для r-value ссылок (временных объектов) с перемещением
-        Node(T&& value) : data(std::move(value)), prev(nullptr), next(nullptr) {}
+        Node(T&& value) : data(std::move(value)) {}
+
+        // Конструирование данных на месте из произвольных аргументов
+        template<typename... Args>
+        Node(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...) {}
     };
-    
-    Node* head;     // Указатель на первый узел списка 
-    Node* tail;     // Указатель на последний узел списка 
-    size_t size_;   // Количество элементов в списке
-    
-public:
-    List() : head(nullptr), tail(nullptr), size_(0) {}
-    
-    // Копирующий конструктор 
-    List(const List& other) : head(nullptr), tail(nullptr), size_(0) {
-        // Используем push_back для добавления каждого элемента
-        Node* current = other.head;
-        while (current) {
-            push_back(current->data);  // Создаем копию каждого элемента
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using PointerAllocator = typename NodeTraits::template rebind_alloc<Node*>;
+    using PointerTraits = std::allocator_traits<PointerAllocator>;
+
+    NodeBase sentinel;    // Фиктивный узел: позиция end()
+    size_t size_;         // Количество элементов в списке
+    NodeAllocator alloc;  // Аллокатор узлов
+
+    // Последний посещенный по индексу узел: позволяет последовательным
+    // обращениям по индексу обходиться O(1) шагов вместо прохода от головы.
+    // Обновляется только неконстантными методами: const-доступ по индексу
+    // кэш лишь читает, поэтому безопасен для одновременных читателей.
+    size_t cached_index;      // Индекс запомненного узла
+    NodeBase* cached_node;    // Запомненный узел (nullptr - кэш недействителен)
+
+    static Node* as_node(NodeBase* base) {
+        return static_cast<Node*>(base);
+    }
+
+    // Выделение памяти под узел и его конструирование
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc, 1);
+        Stats::on_allocate(sizeof(Node));
+        try {
+            NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc, node, 1);
+            Stats::on_deallocate(sizeof(Node));
+            throw;
+        }
+        count_construction<T, Args&&...>(static_cast<Stats&>(*this));
+        return node;
+    }
+
+    // Уничтожение узла и возврат памяти аллокатору
+    void destroy_node(Node* node) {
+        NodeTraits::destroy(alloc, node);
+        NodeTraits::deallocate(alloc, node, 1);
+        Stats::on_deallocate(sizeof(Node));
+    }
+
+    // Присваивание данным существующего узла (с учетом в статистике)
+    template<typename U>
+    void assign_element(T& dst, U&& src) {
+        dst = std::forward<U>(src);
+        count_assignment<T, U&&>(static_cast<Stats&>(*this));
+    }
+
+    // Связывание цепочки [first, last] перед узлом pos за O(1)
+    static void link_range_before(NodeBase* pos, NodeBase* first, NodeBase* last) {
+        first->prev = pos->prev;
+        last->next = pos;
+        pos->prev->next = first;
+        pos->prev = last;
+    }
+
+    // Исключение цепочки [first, last] из списка без освобождения памяти
+    static void unlink_range(NodeBase* first, NodeBase* last) {
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+    }
+
+    void invalidate_cache() {
+        cached_node = nullptr;
+    }
+
+    // Вставка узла перед pos за O(1)
+    void link_before(NodeBase* pos, Node* node) {
+        if (pos != &sentinel) {
+            invalidate_cache();  // Индексы узлов после вставки сдвигаются
+        }
+        link_range_before(pos, node, node);
+        ++size_;
+    }
+
+    // Удаление узла за O(1). Возвращает следующий узел.
+    NodeBase* erase_node(NodeBase* node) {
+        if (node->next != &sentinel || node == cached_node) {
+            invalidate_cache();  // Удаление последнего узла индексы не сдвигает
+        }
+        NodeBase* next = node->next;
+        unlink_range(node, node);  // Обновляем связи соседних узлов
+        destroy_node(as_node(node));  // Освобождаем память удаляемого узла
+        --size_;
+        return next;
+    }
+
+    // Узел с индексом pos (для pos == size_ - фиктивный узел) без изменения
+    // состояния списка; в hops возвращается число пройденных узлов.
+    // Проход начинается с ближайшей из трех точек: головы, хвоста или запомненного узла.
+    NodeBase* find_node(size_t pos, size_t& hops) const {
+        NodeBase* end_node = const_cast<NodeBase*>(&sentinel);
+        hops = 0;
+        if (pos == size_) {
+            return end_node;
+        }
+
+        // Расстояния от головы и от хвоста (хвостом считаем фиктивный узел с индексом size_)
+        NodeBase* current = end_node->next;
+        size_t from = 0;
+        size_t best = pos;
+        if (size_ - pos < best) {
+            current = end_node;
+            from = size_;
+            best = size_ - pos;
+        }
+        if (cached_node) {
+            size_t distance = cached_index > pos ? cached_index - pos : pos - cached_index;
+            if (distance < best) {
+                current = cached_node;
+                from = cached_index;
+            }
+        }
+
+        hops = from > pos ? from - pos : pos - from;
+        for (; from < pos; ++from) {
             current = current->next;
         }
+        for (; from > pos; --from) {
+            current = current->prev;
+        }
+        return current;
     }
-    
-    // Перемещающий конструктор 
-    List(List&& other) noexcept 
-        : head(other.head), tail(other.tail), size_(other.size_) {
-        // Обнуляем указатели исходного списка, чтобы избежать двойного удаления
-        other.head = nullptr;
-        other.tail = nullptr;
+
+    // Узел с индексом pos с учетом переходов в статистике; узел запоминается
+    NodeBase* node_at(size_t pos) {
+        size_t hops;
+        NodeBase* node = find_node(pos, hops);
+        Stats::on_node_hops(hops);
+        if (node != &sentinel) {
+            cached_index = pos;
+            cached_node = node;
+        }
+        return node;
+    }
+
+    // То же для const-доступа: только чтение, кэш и статистика не меняются
+    NodeBase* node_at(size_t pos) const {
+        size_t hops;
+        return find_node(pos, hops);
+    }
+
+    // Перехват узлов другого списка (текущий список должен быть пуст)
+    void take_nodes(List& other) noexcept {
+        if (other.size_ == 0) {
+            return;
+        }
+        invalidate_cache();
+        other.invalidate_cache();
+        link_range_before(&sentinel, other.sentinel.next, other.sentinel.prev);
+        size_ = other.size_;
+
+        // Возвращаем исходный список в пустое состояние
+        other.sentinel.next = other.sentinel.prev = &other.sentinel;
         other.size_ = 0;
     }
-    
+
+    // Проверка, что узлы другого списка можно перевязать в этот
+    void check_same_allocator(const List& other) const {
+        if (!(alloc == other.alloc)) {
+            throw std::invalid_argument("Списки используют разные аллокаторы");
+        }
+    }
+
+    // Слияние двух отсортированных цепочек, завершающихся nullptr (связи prev не поддерживаются).
+    // При равенстве первым идет элемент из a, поэтому слияние устойчиво.
+    template<typename Compare>
+    static NodeBase* merge_chains(NodeBase* a, NodeBase* b, Compare& comp) {
+        NodeBase head;
+        NodeBase* last = &head;
+        while (a && b) {
+            if (comp(as_node(b)->data, as_node(a)->data)) {
+                last->next = b;
+                b = b->next;
+            } else {
+                last->next = a;
+                a = a->next;
+            }
+            last = last->next;
+        }
+        last->next = a ? a : b;
+        return head.next;
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    List() : size_(0), alloc(), cached_index(0), cached_node(nullptr) {}
+
+    // Пустой список с заданным аллокатором (например, PoolAllocator или std::pmr::polymorphic_allocator)
+    explicit List(const Allocator& allocator)
+        : size_(0), alloc(allocator), cached_index(0), cached_node(nullptr) {}
+
+    // Копирующий конструктор
+    List(const List& other)
+        : List(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.get_allocator())) {}
+
+    // Копирующий конструктор с заданным аллокатором
+    List(const List& other, const Allocator& allocator)
+        : size_(0), alloc(allocator), cached_index(0), cached_node(nullptr) {
+        try {
+            // Используем push_back для добавления каждого элемента
+            for (NodeBase* current = other.sentinel.next; current != &other.sentinel; current = current->next) {
+                push_back(as_node(current)->data);  // Создаем копию каждого элемента
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    // Перемещающий конструктор
+    List(List&& other) noexcept
+        : size_(0), alloc(std::move(other.alloc)), cached_index(0), cached_node(nullptr) {
+        take_nodes(other);
+    }
+
     // Копирующий оператор присваивания
     List& operator=(const List& other) {
         // Проверка на самоприсваивание
         if (this != &other) {
-            clear();  // Освобождаем текущие ресурсы
-            
-            // Копируем элементы из другого списка
-            Node* current = other.head;
-            while (current) {
-                push_back(current->data);
-                current = current->next;
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+                // Узлы, выделенные другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    clear();
+                }
+                alloc = other.alloc;
             }
+
+            // Существующие узлы получают новые значения, создаются только недостающие
+            assign(other.begin(), other.end());
         }
         return *this;  // Возвращаем ссылку на текущий объект
     }
-    
+
     // Перемещающий оператор присваивания
-    List& operator=(List&& other) noexcept {
+    List& operator=(List&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value ||
+                                           NodeTraits::is_always_equal::value) {
         if (this != &other) {
             clear();  // Освобождаем текущие ресурсы
-            
-            // Перехватываем ресурсы другого списка
-            head = other.head;
-            tail = other.tail;
-            size_ = other.size_;
-            
-            // Обнуляем указатели исходного списка
-            other.head = nullptr;
-            other.tail = nullptr;
-            other.size_ = 0;
+
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                alloc = std::move(other.alloc);
+                take_nodes(other);  // Перехватываем ресурсы другого списка
+            } else if (alloc == other.alloc) {
+                take_nodes(other);
+            } else {
+                // Узлы чужого аллокатора перехватить нельзя: перемещаем элементы
+                for (NodeBase* current = other.sentinel.next; current != &other.sentinel; current = current->next) {
+                    push_back(std::move(as_node(current)->data));
+                }
+                other.clear();
+            }
         }
         return *this;
     }
-    
+
     ~List() {
         clear();
     }
-    
-    // Очистка списка 
+
+    // Очистка списка
     void clear() {
-        while (head) {
-            Node* temp = head;    // Сохраняем указатель на текущий узел
-            head = head->next;    // Перемещаем head на следующий узел
-            delete temp;          // Освобождаем память текущего узла
+        NodeBase* current = sentinel.next;
+        while (current != &sentinel) {
+            Node* temp = as_node(current);  // Сохраняем указатель на текущий узел
+            current = current->next;        // Переходим к следующему узлу
+            destroy_node(temp);             // Освобождаем память текущего узла
         }
-        tail = nullptr;  // Обнуляем tail
+        sentinel.next = sentinel.prev = &sentinel;
         size_ = 0;       // Сбрасываем счетчик размера
+        invalidate_cache();
     }
-    
+
+    // Очистка без возврата узлов аллокатору: вызываются только деструкторы
+    // элементов (для тривиально уничтожаемых T - O(1), без прохода по узлам).
+    // Для списков в пуле, который затем освобождает всю память сразу за
+    // O(числа блоков) (NodePool::release()). С обычным аллокатором узлы утекают.
+    void discard_nodes() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            NodeBase* current = sentinel.next;
+            while (current != &sentinel) {
+                NodeBase* next = current->next;
+                NodeTraits::destroy(alloc, as_node(current));
+                current = next;
+            }
+        }
+        sentinel.next = sentinel.prev = &sentinel;
+        size_ = 0;
+        invalidate_cache();
+    }
+
+    // Замена содержимого элементами диапазона [first, last): существующие узлы
+    // получают новые значения, узлы создаются только для недостающих элементов,
+    // а освобождаются только лишние. Диапазон не должен указывать на элементы
+    // самого списка.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        NodeBase* current = sentinel.next;
+        for (; current != &sentinel && first != last; current = current->next, ++first) {
+            assign_element(as_node(current)->data, *first);
+        }
+        for (; first != last; ++first) {
+            link_before(&sentinel, create_node(*first));
+        }
+        while (current != &sentinel) {
+            current = erase_node(current);
+        }
+    }
+
     // Добавление элемента в конец списка (для l-value)
     void push_back(const T& value) {
-        Node* new_node = new Node(value);  // Создаем новый узел
-        
-        if (!head) {
-            // Если список пуст, новый узел становится и head, и tail
-            head = tail = new_node;
-        } else {
-            // Добавляем новый узел после текущего tail
-            tail->next = new_node;    // Текущий tail указывает на новый узел
-            new_node->prev = tail;    // Новый узел указывает назад на старый tail
-            tail = new_node;          // Новый узел становится новым tail
-        }
-        ++size_; 
+        link_before(&sentinel, create_node(value));  // Новый узел становится последним
     }
-    
+
     // Добавление элемента в конец списка (для r-value - с перемещением)
     void push_back(T&& value) {
-        Node* new_node = new Node(std::move(value));  // Перемещаем значение
-        if (!head) {
-            head = tail = new_node;
-        } else {
-            tail->next = new_node;
-            new_node->prev = tail;
-            tail = new_node;
-        }
-        ++size_;
+        link_before(&sentinel, create_node(std::move(value)));  // Перемещаем значение
     }
-    
+
+    // Конструирование элемента на месте в конце списка
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* new_node = create_node(std::in_place, std::forward<Args>(args)...);
+        link_before(&sentinel, new_node);
+        return new_node->data;
+    }
+
     // Добавление элемента в начало списка (для l-value)
     void push_front(const T& value) {
-        Node* new_node = new Node(value);
-        
-        if (!head) {
-            // Если список пуст, новый узел становится и head, и tail
-            head = tail = new_node;
-        } else {
-            // Добавляем новый узел перед текущим head
-            new_node->next = head;    // Новый узел указывает на старый head
-            head->prev = new_node;    // Старый head указывает назад на новый узел
-            head = new_node;          // Новый узел становится новым head
-        }
-        ++size_;
+        link_before(sentinel.next, create_node(value));  // Новый узел становится первым
     }
-    
+
     // Добавление элемента в начало списка (для r-value)
     void push_front(T&& value) {
-        Node* new_node = new Node(std::move(value));
-        
-        if (!head) {
-            head = tail = new_node;
-        } else {
-            new_node->next = head;
-            head->prev = new_node;
-            head = new_node;
+        link_before(sentinel.next, create_node(std::move(value)));
+    }
+
+    // Конструирование элемента на месте в начале списка
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        Node* new_node = create_node(std::in_place, std::forward<Args>(args)...);
+        link_before(sentinel.next, new_node);
+        return new_node->data;
+    }
+
+    // Первый и последний элементы за O(1)
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
         }
-        ++size_;
+        return as_node(sentinel.next)->data;
+    }
+
+    const T& front() const {
+        return const_cast<List&>(*this).front();
     }
-    
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого списка");
+        }
+        return as_node(sentinel.prev)->data;
+    }
+
+    const T& back() const {
+        return const_cast<List&>(*this).back();
+    }
+
+    // Удаление последнего элемента
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        erase_node(sentinel.prev);
+    }
+
+    // Удаление первого элемента
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого списка");
+        }
+        erase_node(sentinel.next);
+    }
+
     // Вставка элемента в произвольную позицию (для l-value)
     void insert(size_t pos, const T& value) {
         // Проверка корректности позиции
         if (pos > size_) {
             throw std::out_of_range("Позиция вставки вне диапазона");
         }
-        
-        // вставка в начало или конец
-        if (pos == 0) {
-            push_front(value);
-            return;
-        }
-        
-        if (pos == size_) {
-            push_back(value);
-            return;
-        }
-        
-        // Находим узел, который будет находиться после нового узла
-        Node* current = head;
-        for (size_t i = 0; i < pos; ++i) {
-            current = current->next;
-        }
-        
-        // Создаем новый узел и вставляем его перед current
-        Node* new_node = new Node(value);
-        new_node->prev = current->prev;  
-        
-        current->prev->next = new_node;
-        current->prev = new_node;
-        
-        ++size_;
+
+        // Находим узел, который будет находиться после нового узла, и вставляем перед ним
+        NodeBase* current = node_at(pos);
+        Node* new_node = create_node(value);
+        link_before(current, new_node);
+
+        // Новый узел занимает индекс pos - запоминаем его для следующего обращения
+        cached_index = pos;
+        cached_node = new_node;
     }
-    
+
     // Вставка элемента в произвольную позицию (для r-value)
     void insert(size_t pos, T&& value) {
         if (pos > size_) {
             throw std::out_of_range("Позиция вставки вне диапазона");
         }
-        
-        if (pos == 0) {
-            push_front(std::move(value));
-            return;
-        }
-        
-        if (pos == size_) {
-            push_back(std::move(value));
-            return;
-        }
-        
-        // Находим узел, который будет находиться после нового узла
-        Node* current = head;
-        for (size_t i = 0; i < pos; ++i) {
-            current = current->next;
-        }
-        
-        // Создаем новый узел и вставляем его перед current
-        Node* new_node = new Node(std::move(value));
-        new_node->prev = current->prev;
-        new_node->next = current;
-        current->prev->next = new_node;
-        current->prev = new_node;
-        
-        ++size_;
+
+        NodeBase* current = node_at(pos);
+        Node* new_node = create_node(std::move(value));
+        link_before(current, new_node);
+        cached_index = pos;
+        cached_node = new_node;
     }
-    
+
     // Удаление элемента по позиции
     void erase(size_t pos) {
         // Проверка корректности позиции
         if (pos >= size_) {
             throw std::out_of_range("Позиция удаления вне диапазона");
         }
-        
-        // Находим удаляемый узел
-        Node* current = head;
-        for (size_t i = 0; i < pos; ++i) {
-            current = current->next;
+
+        // Находим удаляемый узел; его индекс переходит к следующему узлу.
+        // При pos < size_ узел не фиктивный, поэтому поиск идет через
+        // find_node без сравнения с sentinel из node_at: иначе GCC после
+        // встраивания видит путь, где erase_node освобождает &sentinel
+        // (-Wfree-nonheap-object).
+        size_t hops;
+        NodeBase* current = find_node(pos, hops);
+        Stats::on_node_hops(hops);
+        NodeBase* next = erase_node(current);
+        if (next != &sentinel) {
+            cached_index = pos;
+            cached_node = next;
         }
-        
-        // Обновляем связи соседних узлов
-        if (current->prev) {
-            // Если есть предыдущий узел, его next указывает на следующий узел
-            current->prev->next = current->next;
-        } else {
-            // Если это первый узел, обновляем head
-            head = current->next;
+    }
+
+    // Доступ к элементу по индексу. Последовательный перебор индексов
+    // стоит амортизированно O(1) на обращение благодаря запомненному узлу.
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
         }
-        
-        if (current->next) {
-            // Если есть следующий узел, его prev указывает на предыдущий узел
-            current->next->prev = current->prev;
-        } else {
-            // Если это последний узел, обновляем tail
-            tail = current->prev;
+        return as_node(node_at(index))->data;
+    }
+
+    // Константный доступ кэш не обновляет (безопасен для одновременных
+    // читателей), поэтому перебор по индексу через const List& стоит O(n)
+    // на обращение, кроме позиций рядом с концами или запомненным узлом
+    const T& operator[](size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
         }
-        
-        delete current;  // Освобождаем память удаляемого узла
-        --size_;
+        return as_node(node_at(index))->data;
     }
-    
+
+    T& at(size_t index) {
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        return (*this)[index];
+    }
+
     // Получение количества элементов в списке
     size_t size() const {
         return size_;
     }
-    
-    // Вложенный класс итератора для обхода списка
-    class iterator {
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Память, занимаемая списком: сам объект и все узлы.
+    // Память, которой владеют сами элементы (например, строки), не учитывается.
+    size_t memory_footprint() const {
+        return sizeof(*this) + size_ * sizeof(Node);
+    }
+
+    // Средний шаг по адресам между соседними узлами, в байтах: мера
+    // локальности обхода. У заполненного подряд или перестроенного
+    // relinearize() списка он близок к размеру узла с накладными расходами
+    // аллокатора; после долгой череды вставок и удалений узлы разбросаны по
+    // куче, шаг растет, и обход начинает упираться в задержку памяти.
+    double average_node_stride() const {
+        if (size_ < 2) {
+            return 0.0;
+        }
+        double total = 0.0;
+        uintptr_t previous = reinterpret_cast<uintptr_t>(sentinel.next);
+        for (const NodeBase* current = sentinel.next->next; current != &sentinel; current = current->next) {
+            uintptr_t address = reinterpret_cast<uintptr_t>(current);
+            total += static_cast<double>(address > previous ? address - previous : previous - address);
+            previous = address;
+        }
+        return total / static_cast<double>(size_ - 1);
+    }
+
+    // Счетчики политики статистики (для NoStats - пустой объект)
+    const Stats& stats() const {
+        return *this;
+    }
+
+    Stats& stats() {
+        return *this;
+    }
+
+    Allocator get_allocator() const {
+        return Allocator(alloc);
+    }
+
+    // Вложенный класс итератора для обхода списка (двунаправленный);
+    // const_iterator дает доступ к элементам только на чтение
+    template<bool Const>
+    class basic_iterator {
     private:
-        Node* current;
-        
+        friend class List;
+        template<bool>
+        friend class basic_iterator;
+
+        NodeBase* current;
+
     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : current(nullptr) {}
+
         // Конструктор итератора
-        iterator(Node* node) : current(node) {}
-        
-        // Оператор разыменования 
-        T& operator*() {
-            return current->data;
+        explicit basic_iterator(NodeBase* node) : current(node) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : current(other.current) {}
+
+        // Оператор разыменования
+        reference operator*() const {
+            return as_node(current)->data;
         }
-        
+
+        pointer operator->() const {
+            return &as_node(current)->data;
+        }
+
         // Префиксный инкремент
-        iterator& operator++() {
-            if (current) {
-                current = current->next;  // Переходим к следующему узлу
-            }
+        basic_iterator& operator++() {
+            current = current->next;  // Переходим к следующему узлу
             return *this;
         }
-        
+
         // Постфиксный инкремент - движение вперед
-        iterator operator++(int) {
-            iterator temp = *this;  // Сохраняем текущее состояние
-            if (current) {
-                current = current->next;
-            }
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;  // Сохраняем текущее состояние
+            current = current->next;
             return temp;  // Возвращаем старое состояние
         }
-        
+
         // Префиксный декремент
-        iterator& operator--() {
-            if (current) {
-                current = current->prev;  // Переходим к предыдущему узлу
-            }
+        basic_iterator& operator--() {
+            current = current->prev;  // Переходим к предыдущему узлу
             return *this;
         }
-        
+
         // Постфиксный декремент
-        iterator operator--(int) {
-            iterator temp = *this;  // Сохраняем текущее состояние
-            if (current) {
-                current = current->prev;
-            }
+        basic_iterator operator--(int) {
+            basic_iterator temp = *this;  // Сохраняем текущее состояние
+            current = current->prev;
             return temp;  // Возвращаем старое состояние
         }
-        
-        // Операторы сравнения для использования в циклах
-        bool operator!=(const iterator& other) const {
-            return current != other.current;
+
+        // Операторы сравнения (iterator и const_iterator сравниваются между собой)
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.current == b.current;
         }
-        
-        bool operator==(const iterator& other) const {
-            return current == other.current;
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return a.current != b.current;
         }
     };
-    
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
     // Метод для получения итератора на начало списка
     iterator begin() {
-        return iterator(head);
+        return iterator(sentinel.next);
     }
-    
+
+    // Итератор за последним элементом; --end() указывает на последний элемент
     iterator end() {
-        return iterator(nullptr);
+        return iterator(&sentinel);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(sentinel.next);
+    }
+
+    const_iterator end() const {
+        return const_iterator(const_cast<NodeBase*>(&sentinel));
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    // Конструирование элемента на месте перед pos за O(1).
+    // Возвращает итератор на вставленный элемент.
+    template<typename... Args>
+    iterator emplace(iterator pos, Args&&... args) {
+        Node* new_node = create_node(std::in_place, std::forward<Args>(args)...);
+        link_before(pos.current, new_node);
+        return iterator(new_node);
+    }
+
+    // Вставка элемента перед pos за O(1) (для l-value)
+    iterator insert(iterator pos, const T& value) {
+        Node* new_node = create_node(value);
+        link_before(pos.current, new_node);
+        return iterator(new_node);
+    }
+
+    // Вставка элемента перед pos за O(1) (для r-value)
+    iterator insert(iterator pos, T&& value) {
+        Node* new_node = create_node(std::move(value));
+        link_before(pos.current, new_node);
+        return iterator(new_node);
+    }
+
+    // Удаление элемента по итератору за O(1). Возвращает итератор на следующий элемент.
+    iterator erase(iterator pos) {
+        if (pos.current == &sentinel) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        return iterator(erase_node(pos.current));
+    }
+
+    // Удаление элементов в диапазоне [first, last). Возвращает last.
+    iterator erase(iterator first, iterator last) {
+        while (first != last) {
+            first = erase(first);
+        }
+        return last;
+    }
+
+    // Удаление всех элементов, удовлетворяющих предикату, за один проход.
+    // Возвращает количество удаленных элементов.
+    template<typename Predicate>
+    size_t erase_if(Predicate pred) {
+        size_t removed = 0;
+        for (NodeBase* current = sentinel.next; current != &sentinel;) {
+            if (pred(as_node(current)->data)) {
+                current = erase_node(current);
+                ++removed;
+            } else {
+                current = current->next;
+            }
+        }
+        return removed;
+    }
+
+    // Удаление элементов с позициями из [first, last) (в любом порядке, повторы
+    // допускаются) за один проход: O(n + k log k) вместо O(k * n) при
+    // удалении по одному. Проход идет с того конца, от которого ближе дальняя
+    // удаляемая позиция. Возвращает количество удаленных элементов.
+    template<typename InputIt>
+    size_t erase_indices(InputIt first, InputIt last) {
+        std::vector<size_t> indices = sorted_index_set(first, last, size_);
+        if (indices.empty()) {
+            return 0;
+        }
+        if (indices.back() <= size_ - indices.front()) {
+            NodeBase* current = sentinel.next;
+            size_t position = 0;
+            for (size_t index : indices) {
+                Stats::on_node_hops(index - position);
+                for (; position < index; ++position) {
+                    current = current->next;
+                }
+                current = erase_node(current);  // Следующий узел занимал позицию index + 1
+                ++position;
+            }
+        } else {
+            NodeBase* current = sentinel.prev;
+            size_t position = size_ - 1;
+            for (auto it = indices.rbegin(); it != indices.rend(); ++it) {
+                Stats::on_node_hops(position - *it);
+                for (; position > *it; --position) {
+                    current = current->prev;
+                }
+                NodeBase* prev = current->prev;
+                erase_node(current);
+                current = prev;
+                --position;
+            }
+        }
+        return indices.size();
+    }
+
+    // Перенос всех элементов other перед pos за O(1): узлы только перевязываются
+    void splice(iterator pos, List& other) {
+        if (this == &other || other.size_ == 0) {
+            return;
+        }
+        check_same_allocator(other);
+        invalidate_cache();
+        other.invalidate_cache();
+        size_t count = other.size_;
+        NodeBase* first = other.sentinel.next;
+        NodeBase* last = other.sentinel.prev;
+        unlink_range(first, last);
+        link_range_before(pos.current, first, last);
+        size_ += count;
+        other.size_ = 0;
+    }
+
+    void splice(iterator pos, List&& other) {
+        splice(pos, other);
+    }
+
+    // Перенос одного элемента it из other перед pos за O(1)
+    void splice(iterator pos, List& other, iterator it) {
+        NodeBase* node = it.current;
+        if (node == pos.current || node->next == pos.current) {
+            return;  // Элемент уже стоит на нужном месте
+        }
+        check_same_allocator(other);
+        invalidate_cache();
+        other.invalidate_cache();
+        unlink_range(node, node);
+        link_range_before(pos.current, node, node);
+        --other.size_;
+        ++size_;
+    }
+
+    // Перенос элементов [first, last) из other перед pos. Перевязка узлов - O(1);
+    // при переносе между разными списками длина диапазона подсчитывается за O(k).
+    void splice(iterator pos, List& other, iterator first, iterator last) {
+        if (first == last) {
+            return;
+        }
+        check_same_allocator(other);
+        invalidate_cache();
+        other.invalidate_cache();
+        if (this != &other) {
+            size_t count = 0;
+            for (NodeBase* current = first.current; current != last.current; current = current->next) {
+                ++count;
+            }
+            other.size_ -= count;
+            size_ += count;
+        }
+        NodeBase* first_node = first.current;
+        NodeBase* last_node = last.current->prev;
+        unlink_range(first_node, last_node);
+        link_range_before(pos.current, first_node, last_node);
+    }
+
+    // Слияние с отсортированным списком other (текущий список тоже должен быть отсортирован).
+    // Узлы other перевязываются без копирования; при равенстве элементы this идут первыми.
+    template<typename Compare>
+    void merge(List& other, Compare comp) {
+        if (this == &other || other.size_ == 0) {
+            return;
+        }
+        check_same_allocator(other);
+        invalidate_cache();
+        other.invalidate_cache();
+
+        NodeBase* current = sentinel.next;
+        while (other.size_ != 0) {
+            NodeBase* node = other.sentinel.next;
+            // Пропускаем элементы this, не большие очередного элемента other
+            while (current != &sentinel && !comp(as_node(node)->data, as_node(current)->data)) {
+                current = current->next;
+            }
+            if (current == &sentinel) {
+                splice(end(), other);  // Остаток other целиком идет в конец
+                return;
+            }
+            // Переносим серию элементов other, меньших current, одной перевязкой
+            NodeBase* last = node;
+            size_t count = 1;
+            while (last->next != &other.sentinel && comp(as_node(last->next)->data, as_node(current)->data)) {
+                last = last->next;
+                ++count;
+            }
+            unlink_range(node, last);
+            link_range_before(current, node, last);
+            other.size_ -= count;
+            size_ += count;
+        }
+    }
+
+    void merge(List& other) {
+        merge(other, std::less<T>());
+    }
+
+    void merge(List&& other) {
+        merge(other);
+    }
+
+    // Устойчивая сортировка слиянием "снизу вверх" за O(n log n).
+    // Узлы только перевязываются: элементы не копируются и не перемещаются,
+    // итераторы остаются действительными.
+    template<typename Compare>
+    void sort(Compare comp) {
+        if (size_ < 2) {
+            return;
+        }
+
+        invalidate_cache();
+
+        // Превращаем кольцо в цепочку, завершающуюся nullptr
+        sentinel.prev->next = nullptr;
+        NodeBase* chain = sentinel.next;
+
+        // bins[i] хранит отсортированную цепочку длиной 2^i (или nullptr)
+        NodeBase* bins[64] = {};
+        size_t used = 0;
+        while (chain) {
+            NodeBase* run = chain;
+            chain = chain->next;
+            run->next = nullptr;
+
+            size_t i = 0;
+            for (; i < used && bins[i]; ++i) {
+                // Более ранняя цепочка идет первым аргументом - это сохраняет устойчивость
+                run = merge_chains(bins[i], run, comp);
+                bins[i] = nullptr;
+            }
+            if (i == used) {
+                ++used;
+            }
+            bins[i] = run;
+        }
+
+        NodeBase* result = nullptr;
+        for (size_t i = 0; i < used; ++i) {
+            if (bins[i]) {
+                result = result ? merge_chains(bins[i], result, comp) : bins[i];
+            }
+        }
+
+        // Восстанавливаем обратные связи и замыкаем кольцо
+        NodeBase* prev = &sentinel;
+        sentinel.next = result;
+        for (NodeBase* current = result; current; current = current->next) {
+            current->prev = prev;
+            prev = current;
+        }
+        prev->next = &sentinel;
+        sentinel.prev = prev;
+    }
+
+    void sort() {
+        sort(std::less<T>());
+    }
+
+    // Перестройка узлов в порядке списка для восстановления локальности обхода
+    // (см. average_node_stride()). Память под все новые узлы выделяется подряд
+    // до освобождения старых, и элементы раскладываются по ней в порядке
+    // возрастания адресов: если аллокатор выдал свежую непрерывную область,
+    // список ляжет в нее подряд, а если отдал разбросанные освободившиеся
+    // куски - обход все равно пойдет по памяти в одну сторону. Элементы
+    // переносятся в новые узлы: итераторы, указатели и ссылки на элементы
+    // становятся недействительными. Если выделение памяти или копирование
+    // элемента бросит исключение, список не меняется.
+    void relinearize() {
+        if (size_ == 0) {
+            return;
+        }
+        // Адреса новых узлов собираются во временный массив и упорядочиваются
+        PointerAllocator pointer_alloc(alloc);
+        Node** nodes = PointerTraits::allocate(pointer_alloc, size_);
+        Stats::on_allocate(size_ * sizeof(Node*));
+        size_t allocated = 0;
+        size_t built = 0;
+
+        // Новые узлы связываются в отдельное кольцо в порядке списка
+        NodeBase fresh;
+        try {
+            for (; allocated < size_; ++allocated) {
+                nodes[allocated] = NodeTraits::allocate(alloc, 1);
+                Stats::on_allocate(sizeof(Node));
+            }
+            std::sort(nodes, nodes + size_, std::less<Node*>());
+            for (NodeBase* current = sentinel.next; current != &sentinel; current = current->next, ++built) {
+                NodeTraits::construct(alloc, nodes[built], std::move_if_noexcept(as_node(current)->data));
+                count_construction<T, decltype(std::move_if_noexcept(std::declval<T&>()))>(static_cast<Stats&>(*this));
+                link_range_before(&fresh, nodes[built], nodes[built]);
+            }
+        } catch (...) {
+            for (size_t i = 0; i < built; ++i) {
+                destroy_node(nodes[i]);
+            }
+            for (size_t i = built; i < allocated; ++i) {
+                NodeTraits::deallocate(alloc, nodes[i], 1);
+                Stats::on_deallocate(sizeof(Node));
+            }
+            PointerTraits::deallocate(pointer_alloc, nodes, size_);
+            Stats::on_deallocate(size_ * sizeof(Node*));
+            throw;
+        }
+        PointerTraits::deallocate(pointer_alloc, nodes, size_);
+        Stats::on_deallocate(size_ * sizeof(Node*));
+
+        for (NodeBase* current = sentinel.next; current != &sentinel;) {
+            NodeBase* next = current->next;
+            destroy_node(as_node(current));
+            current = next;
+        }
+        sentinel.next = fresh.next;
+        sentinel.prev = fresh.prev;
+        sentinel.next->prev = &sentinel;
+        sentinel.prev->next = &sentinel;
+        invalidate_cache();
     }
 };
 
-#endif 
\ No newline at end of file
+// Список, узлы которого выделяются из std::pmr::memory_resource (например, NodePool)
+template<typename T, typename Stats = NoStats>
+using PmrList = List<T, std::pmr::polymorphic_allocator<T>, Stats>;
+
+#endif
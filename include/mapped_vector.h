@@ -0,0 +1,380 @@
+#ifndef MAPPED_VECTOR_H
+#define MAPPED_VECTOR_H
+
+#include "contiguous_iterator.h"
+#include "growth_policy.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define MAPPED_VECTOR_SUPPORTED 1
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Метка типа элемента, записываемая в заголовок файла MappedVector.
+// По умолчанию - хеш FNV-1a от typeid(T).name(): он одинаков между запусками
+// одной сборки, но может отличаться между компиляторами. Для файлов,
+// которые читают программы разных сборок, метку следует специализировать.
+template<typename T>
+struct mapped_type_tag {
+    static uint64_t value() {
+        uint64_t hash = 14695981039346656037ull;
+        for (const char* p = typeid(T).name(); *p; ++p) {
+            hash = (hash ^ static_cast<unsigned char>(*p)) * 1099511628211ull;
+        }
+        return hash;
+    }
+};
+
+// Заголовок файла MappedVector (64 байта в начале файла)
+struct MappedVectorHeader {
+    static constexpr char magic_value[8] = {'M', 'A', 'P', 'V', 'E', 'C', 0, 0};
+    static constexpr uint32_t current_version = 1;
+
+    char magic[8];          // Сигнатура формата
+    uint32_t version;       // Версия формата
+    uint32_t header_size;   // Смещение первого элемента от начала файла
+    uint64_t type_tag;      // Метка типа элемента (mapped_type_tag)
+    uint64_t element_size;  // sizeof(T)
+    uint64_t size;          // Количество элементов
+    uint64_t capacity;      // Емкость: под столько элементов размечен файл
+    uint64_t reserved[2];
+};
+
+static_assert(sizeof(MappedVectorHeader) == 64, "Заголовок MappedVector должен занимать 64 байта");
+
+enum class MapMode {
+    ReadWrite,  // Открыть или создать файл для чтения и записи
+    ReadOnly    // Открыть существующий файл только для чтения: доступ к элементам только константный
+};
+
+// Вектор, элементы которого хранятся в отображенном в память файле.
+// Данные попадают в файл без сериализации, а повторное открытие сводится
+// к проверке заголовка и mmap - без чтения и разбора содержимого.
+// Рост: файл удлиняется через ftruncate и отображается заново; адреса
+// элементов при этом меняются, как у обычного вектора при перевыделении.
+// Mode - режим открытия. В режиме ReadOnly все методы доступа, включая
+// неконстантные, возвращают константные ссылки и итераторы, поэтому запись
+// в отображение только для чтения не компилируется, а чтение работает как обычно.
+// Growth - политика роста емкости (см. growth_policy.h).
+template<typename T, MapMode Mode = MapMode::ReadWrite, typename Growth = PageGrowth<>>
+class MappedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector хранит только тривиально копируемые типы");
+    static_assert(alignof(T) <= sizeof(MappedVectorHeader), "Выравнивание элемента больше размера заголовка");
+
+private:
+    static constexpr size_t header_size = sizeof(MappedVectorHeader);
+    static constexpr bool read_only = Mode == MapMode::ReadOnly;
+
+    // Тип элемента, доступный через неконстантные методы
+    using element_type = std::conditional_t<read_only, const T, T>;
+
+    std::string path_;              // Путь к файлу
+    int fd;                         // Дескриптор открытого файла
+    MappedVectorHeader* header;     // Начало отображения (заголовок)
+    T* data_;                       // Первый элемент (сразу за заголовком)
+    size_t mapped_bytes;            // Длина отображения
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::system_error(errno, std::generic_category(), what + ": " + path_);
+    }
+
+    // Проверка перед изменением размера или содержимого (push_back, reserve, ...)
+    void check_writable() const {
+        if (read_only) {
+            throw std::logic_error("MappedVector открыт только для чтения: " + path_);
+        }
+    }
+
+    static size_t file_bytes(size_t capacity) {
+        return header_size + capacity * sizeof(T);
+    }
+
+    // Отображение первых bytes байт файла. Прежнее отображение снимается
+    // только после успешного mmap, поэтому при ошибке вектор остается целым.
+    void map(size_t bytes) {
+        int protection = read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+        void* p = mmap(nullptr, bytes, protection, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            fail("Не удалось отобразить файл");
+        }
+        unmap();
+        header = static_cast<MappedVectorHeader*>(p);
+        data_ = reinterpret_cast<T*>(static_cast<char*>(p) + header_size);
+        mapped_bytes = bytes;
+    }
+
+    void unmap() {
+        if (header) {
+            munmap(header, mapped_bytes);
+            header = nullptr;
+            data_ = nullptr;
+            mapped_bytes = 0;
+        }
+    }
+
+    // Разметка пустого файла: заголовок и емкость по политике роста
+    void initialize() {
+        size_t capacity = Growth::next_capacity(0, 1, sizeof(T));
+        if (ftruncate(fd, static_cast<off_t>(file_bytes(capacity))) != 0) {
+            fail("Не удалось изменить размер файла");
+        }
+        map(file_bytes(capacity));
+        std::memset(header, 0, header_size);
+        std::memcpy(header->magic, MappedVectorHeader::magic_value, sizeof(header->magic));
+        header->version = MappedVectorHeader::current_version;
+        header->header_size = static_cast<uint32_t>(header_size);
+        header->type_tag = mapped_type_tag<T>::value();
+        header->element_size = sizeof(T);
+        header->size = 0;
+        header->capacity = capacity;
+    }
+
+    // Проверка заголовка существующего файла
+    void validate(size_t bytes) const {
+        if (std::memcmp(header->magic, MappedVectorHeader::magic_value, sizeof(header->magic)) != 0) {
+            throw std::runtime_error("Файл не является MappedVector: " + path_);
+        }
+        if (header->version != MappedVectorHeader::current_version || header->header_size != header_size) {
+            throw std::runtime_error("Неподдерживаемая версия формата MappedVector: " + path_);
+        }
+        if (header->type_tag != mapped_type_tag<T>::value() || header->element_size != sizeof(T)) {
+            throw std::runtime_error("Файл MappedVector содержит элементы другого типа: " + path_);
+        }
+        if (header->size > header->capacity || file_bytes(header->capacity) > bytes) {
+            throw std::runtime_error("Файл MappedVector поврежден: " + path_);
+        }
+    }
+
+    void open_file() {
+        fd = ::open(path_.c_str(), read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            fail("Не удалось открыть файл");
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            fail("Не удалось получить размер файла");
+        }
+        size_t bytes = static_cast<size_t>(st.st_size);
+        if (bytes == 0 && !read_only) {
+            initialize();
+            return;
+        }
+        if (bytes < header_size) {
+            throw std::runtime_error("Файл не является MappedVector: " + path_);
+        }
+        map(bytes);
+        validate(bytes);
+    }
+
+    void close_file() {
+        unmap();
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    // Удлинение файла под new_capacity элементов и повторное отображение
+    void grow(size_t new_capacity) {
+        if (ftruncate(fd, static_cast<off_t>(file_bytes(new_capacity))) != 0) {
+            fail("Не удалось изменить размер файла");
+        }
+        map(file_bytes(new_capacity));
+        header->capacity = new_capacity;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = element_type&;
+    using const_reference = const T&;
+    using iterator = ContiguousIterator<element_type, MappedVector>;
+    using const_iterator = ContiguousIterator<const T, MappedVector>;
+
+    // Открытие файла path. В режиме ReadWrite отсутствующий или пустой
+    // файл создается и размечается; в режиме ReadOnly файл должен существовать.
+    explicit MappedVector(const std::string& path)
+        : path_(path), fd(-1), header(nullptr), data_(nullptr), mapped_bytes(0) {
+        try {
+            open_file();
+        } catch (...) {
+            close_file();
+            throw;
+        }
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : path_(std::move(other.path_)), fd(other.fd), header(other.header), data_(other.data_),
+          mapped_bytes(other.mapped_bytes) {
+        other.fd = -1;
+        other.header = nullptr;
+        other.data_ = nullptr;
+        other.mapped_bytes = 0;
+    }
+
+    MappedVector& operator=(MappedVector&& other) noexcept {
+        if (this != &other) {
+            close_file();
+            path_ = std::move(other.path_);
+            fd = other.fd;
+            header = other.header;
+            data_ = other.data_;
+            mapped_bytes = other.mapped_bytes;
+            other.fd = -1;
+            other.header = nullptr;
+            other.data_ = nullptr;
+            other.mapped_bytes = 0;
+        }
+        return *this;
+    }
+
+    // Закрытие без msync: изменения записываются ядром в фоне.
+    // Для гарантированной записи на диск нужно вызвать flush().
+    ~MappedVector() {
+        close_file();
+    }
+
+    // Методы доступа к элементам (в режиме ReadOnly - только для чтения)
+    reference operator[](size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return data_[index];
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return data_[index];
+    }
+
+    // Указатель на первый элемент в отображении; действителен до роста файла
+    element_type* data() {
+        return data_;
+    }
+
+    const T* data() const {
+        return data_;
+    }
+
+    // Конструирование элемента на месте в конце
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        check_writable();
+        size_t n = size();
+        if (n == capacity()) {
+            // Аргументы могут ссылаться на элементы, которые переедут при повторном отображении
+            T tmp(std::forward<Args>(args)...);
+            size_t new_capacity = Growth::next_capacity(n, n + 1, sizeof(T));
+            grow(new_capacity > n ? new_capacity : n + 1);
+            ::new (static_cast<void*>(data_ + n)) T(tmp);
+        } else {
+            ::new (static_cast<void*>(data_ + n)) T(std::forward<Args>(args)...);
+        }
+        header->size = n + 1;
+        return data_[n];
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    // Удаление последнего элемента
+    void pop_back() {
+        check_writable();
+        if (size() == 0) {
+            throw std::out_of_range("Удаление из пустого вектора");
+        }
+        --header->size;
+    }
+
+    // Резервирование места в файле минимум под new_capacity элементов
+    void reserve(size_t new_capacity) {
+        check_writable();
+        if (new_capacity > capacity()) {
+            grow(new_capacity);
+        }
+    }
+
+    // Удаление всех элементов (размер файла сохраняется)
+    void clear() {
+        check_writable();
+        header->size = 0;
+    }
+
+    // Синхронная запись изменений на диск (msync)
+    void flush() {
+        if (!read_only && msync(header, mapped_bytes, MS_SYNC) != 0) {
+            fail("Не удалось записать изменения на диск");
+        }
+    }
+
+    size_t size() const {
+        return static_cast<size_t>(header->size);
+    }
+
+    size_t capacity() const {
+        return static_cast<size_t>(header->capacity);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    bool is_read_only() const {
+        return read_only;
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+    iterator begin() {
+        return iterator(data_);
+    }
+
+    iterator end() {
+        return iterator(data_ + size());
+    }
+
+    const_iterator begin() const {
+        return const_iterator(data_);
+    }
+
+    const_iterator end() const {
+        return const_iterator(data_ + size());
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef MMAP_ALLOCATOR_H
+#define MMAP_ALLOCATOR_H
+
+#include "growth_policy.h"
+#include "vector.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#else
+#include <cstdlib>
+#endif
+
+// Аллокатор для очень больших буферов. На Linux память берется напрямую
+// у ядра через mmap, а буфер растет через mremap: ядро переносит страницы
+// без копирования данных, и старый и новый буферы не существуют одновременно.
+// На других системах используется malloc/realloc.
+//
+// Метод reallocate() использует Vector: для тривиально перемещаемых T вектор
+// с таким аллокатором растет на месте вместо выделения нового буфера и переноса.
+// Каждое выделение занимает целое число страниц, поэтому аллокатор
+// предназначен для немногих больших буферов, а не для узлов списков.
+template<typename T>
+class MmapAllocator {
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    MmapAllocator() noexcept = default;
+
+    template<typename U>
+    MmapAllocator(const MmapAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+#ifdef __linux__
+        void* p = mmap(nullptr, n * sizeof(T), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#else
+        void* p = std::malloc(n * sizeof(T));
+        if (!p) {
+            throw std::bad_alloc();
+        }
+#endif
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+#ifdef __linux__
+        munmap(p, n * sizeof(T));
+#else
+        (void)n;
+        std::free(p);
+#endif
+    }
+
+    // Изменение размера буфера с old_n до new_n элементов с сохранением
+    // содержимого (побайтово). Буфер может переехать по другому адресу.
+    T* reallocate(T* p, size_t old_n, size_t new_n) {
+#ifdef __linux__
+        void* q = mremap(p, old_n * sizeof(T), new_n * sizeof(T), MREMAP_MAYMOVE);
+        if (q == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#else
+        (void)old_n;
+        void* q = std::realloc(p, new_n * sizeof(T));
+        if (!q) {
+            throw std::bad_alloc();
+        }
+#endif
+        return static_cast<T*>(q);
+    }
+
+    template<typename U>
+    bool operator==(const MmapAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const MmapAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+// Вектор для десятков гигабайт данных: рост через mremap без копирования
+// и без пика памяти "старый буфер + новый буфер", емкость кратна странице
+template<typename T, typename Stats = NoStats>
+using HugeVector = Vector<T, MmapAllocator<T>, Stats, PageGrowth<>>;
+
+#endif
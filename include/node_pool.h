@@ -0,0 +1,196 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+// Пул узлов (slab-аллокатор) для List, ForwardList и других узловых контейнеров.
+// Память берется у вышестоящего ресурса крупными непрерывными блоками и
+// нарезается на слоты фиксированного размера; освобожденные слоты попадают
+// в список свободных слотов своего класса размеров и переиспользуются.
+// Вся память пула возвращается одним вызовом release() за O(числа блоков);
+// список целиком снимается с пула парой list.discard_nodes() + pool.release()
+// без поузлового освобождения.
+class NodePool : public std::pmr::memory_resource {
+public:
+    static constexpr size_t slot_alignment = alignof(std::max_align_t);  // Выравнивание слотов
+    static constexpr size_t class_count = 16;                            // Число классов размеров
+    static constexpr size_t max_slot_size = slot_alignment * class_count; // Больше - в обход пула
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;  // Следующий свободный слот того же класса
+    };
+
+    struct Block {
+        Block* next;   // Следующий блок в списке всех блоков пула
+        size_t bytes;  // Полный размер блока вместе с заголовком
+    };
+
+    struct SizeClass {
+        FreeSlot* free_list = nullptr;  // Освобожденные слоты
+        char* cursor = nullptr;         // Начало нетронутой части текущего блока
+        char* end = nullptr;            // Конец текущего блока
+    };
+
+    static constexpr size_t header_size = (sizeof(Block) + slot_alignment - 1) / slot_alignment * slot_alignment;
+
+    SizeClass classes[class_count];
+    Block* blocks;                        // Все выделенные блоки
+    size_t block_count_;                  // Количество блоков
+    size_t slots_per_block;               // Сколько слотов нарезается из одного блока
+    std::pmr::memory_resource* upstream;  // Источник памяти для блоков
+
+    static size_t class_index(size_t bytes) {
+        return bytes == 0 ? 0 : (bytes - 1) / slot_alignment;
+    }
+
+    static bool pooled(size_t bytes, size_t alignment) {
+        return bytes <= max_slot_size && alignment <= slot_alignment;
+    }
+
+    // Выделение нового блока под класс размеров index
+    void refill(size_t index) {
+        size_t slot_size = (index + 1) * slot_alignment;
+        size_t bytes = header_size + slot_size * slots_per_block;
+        Block* block = static_cast<Block*>(upstream->allocate(bytes, slot_alignment));
+        block->next = blocks;
+        block->bytes = bytes;
+        blocks = block;
+        ++block_count_;
+
+        char* first = reinterpret_cast<char*>(block) + header_size;
+        classes[index].cursor = first;
+        classes[index].end = first + slot_size * slots_per_block;
+    }
+
+public:
+    explicit NodePool(size_t nodes_per_block = 256,
+                      std::pmr::memory_resource* upstream_resource = std::pmr::get_default_resource())
+        : blocks(nullptr), block_count_(0),
+          slots_per_block(nodes_per_block == 0 ? 1 : nodes_per_block), upstream(upstream_resource) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() override {
+        release();
+    }
+
+    // Выделение одного слота. Невиртуальный путь для PoolAllocator.
+    void* allocate_node(size_t bytes, size_t alignment) {
+        if (!pooled(bytes, alignment)) {
+            return upstream->allocate(bytes, alignment);
+        }
+
+        size_t index = class_index(bytes);
+        SizeClass& sc = classes[index];
+        if (sc.free_list) {
+            // Сначала переиспользуем освобожденные слоты
+            FreeSlot* slot = sc.free_list;
+            sc.free_list = slot->next;
+            return slot;
+        }
+        if (sc.cursor == sc.end) {
+            refill(index);
+        }
+        void* slot = sc.cursor;
+        sc.cursor += (index + 1) * slot_alignment;
+        return slot;
+    }
+
+    // Возврат слота в список свободных слотов его класса
+    void deallocate_node(void* p, size_t bytes, size_t alignment) {
+        if (!pooled(bytes, alignment)) {
+            upstream->deallocate(p, bytes, alignment);
+            return;
+        }
+        SizeClass& sc = classes[class_index(bytes)];
+        FreeSlot* slot = static_cast<FreeSlot*>(p);
+        slot->next = sc.free_list;
+        sc.free_list = slot;
+    }
+
+    // Возврат всех блоков вышестоящему ресурсу за O(числа блоков).
+    // Все выделенные из пула узлы становятся недействительными, поэтому к
+    // моменту вызова каждый контейнер, использующий пул, должен быть уже
+    // уничтожен или отцеплен от своих узлов (List/ForwardList::discard_nodes()):
+    // иначе его деструктор вернет пулу уже освобожденную память.
+    void release() {
+        while (blocks) {
+            Block* block = blocks;
+            blocks = block->next;
+            upstream->deallocate(block, block->bytes, slot_alignment);
+        }
+        block_count_ = 0;
+        for (SizeClass& sc : classes) {
+            sc = SizeClass();
+        }
+    }
+
+    // Количество блоков, полученных у вышестоящего ресурса
+    size_t block_count() const {
+        return block_count_;
+    }
+
+    std::pmr::memory_resource* upstream_resource() const {
+        return upstream;
+    }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return allocate_node(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        deallocate_node(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Типизированный аллокатор поверх NodePool. В отличие от
+// std::pmr::polymorphic_allocator обращается к пулу без виртуальных вызовов.
+template<typename T>
+class PoolAllocator {
+private:
+    template<typename U>
+    friend class PoolAllocator;
+
+    NodePool* pool;  // Пул, из которого выделяются узлы (не владеет им)
+
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(NodePool& node_pool) noexcept : pool(&node_pool) {}
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(pool->allocate_node(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        pool->deallocate_node(p, n * sizeof(T), alignof(T));
+    }
+
+    NodePool* resource() const noexcept {
+        return pool;
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept {
+        return pool == other.pool;
+    }
+
+    template<typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept {
+        return pool != other.pool;
+    }
+};
+
+#endif
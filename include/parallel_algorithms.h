@@ -0,0 +1,358 @@
+#ifndef PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_H
+
+#include "thread_pool.h"
+#include "vector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Параллельные алгоритмы над Vector, std::vector и диапазонами итераторов
+// произвольного доступа: for_each, transform, reduce, count_if, sort
+// (параллельная сортировка слиянием) и inclusive_scan.
+//
+// Диапазон делится на блоки (грануляция подбирается по длине диапазона и
+// числу потоков пула - около восьми блоков на поток), а блоки раздаются
+// рекурсивным делением пополам: одна половина выполняется сразу, другая
+// ставится в очередь пула, откуда ее может перехватить свободный поток.
+// Операции в reduce и inclusive_scan должны быть ассоциативными.
+namespace parallel {
+
+// Параметры запуска алгоритма
+struct Options {
+    ThreadPool* pool = nullptr;                     // Пул (nullptr - ThreadPool::instance())
+    const CancellationToken* cancellation = nullptr; // Флаг отмены: алгоритм бросит OperationCancelled
+    size_t grain = 0;                               // Элементов в блоке (0 - подобрать автоматически)
+};
+
+namespace detail {
+
+template<typename It, typename = void>
+struct is_random_access_iterator : std::false_type {};
+
+template<typename It>
+struct is_random_access_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category> {};
+
+// Контейнеры с непрерывным хранением, для которых есть перегрузки алгоритмов
+template<typename C>
+struct is_contiguous_container : std::false_type {};
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+struct is_contiguous_container<Vector<T, Allocator, Stats, Growth>> : std::true_type {};
+
+template<typename T, typename Allocator>
+struct is_contiguous_container<std::vector<T, Allocator>> : std::true_type {};
+
+template<typename It>
+using if_iterator = std::enable_if_t<is_random_access_iterator<It>::value, int>;
+
+template<typename C>
+using if_container = std::enable_if_t<is_contiguous_container<std::remove_const_t<C>>::value, int>;
+
+inline ThreadPool& pool_of(const Options& options) {
+    return options.pool ? *options.pool : ThreadPool::instance();
+}
+
+// Размер блока: около восьми блоков на поток, но не меньше min_grain
+// элементов, чтобы накладные расходы на задачу оставались незаметными
+inline size_t grain_size(size_t n, const Options& options, size_t min_grain = 4096) {
+    if (options.grain != 0) {
+        return options.grain;
+    }
+    size_t grain = n / (pool_of(options).thread_count() * 8);
+    return grain < min_grain ? min_grain : grain;
+}
+
+inline size_t block_count(size_t n, size_t grain) {
+    return (n + grain - 1) / grain;
+}
+
+// Блоки [first, last): правые половины уходят в пул, левая выполняется на месте
+template<typename Body>
+void split(TaskGroup& group, size_t first, size_t last, const Body& body) {
+    while (last - first > 1) {
+        size_t mid = first + (last - first) / 2;
+        group.run([&group, mid, last, &body] { split(group, mid, last, body); });
+        last = mid;
+    }
+    if (!group.stop_requested()) {
+        body(first);
+    }
+}
+
+// Выполнение body(block) для всех блоков [0, blocks)
+template<typename Body>
+void for_blocks(size_t blocks, const Options& options, const Body& body) {
+    ThreadPool& pool = pool_of(options);
+    if (blocks <= 1 || pool.thread_count() == 1) {
+        for (size_t block = 0; block < blocks; ++block) {
+            if (options.cancellation && options.cancellation->cancelled()) {
+                throw OperationCancelled();
+            }
+            body(block);
+        }
+        return;
+    }
+    TaskGroup group(pool, options.cancellation);
+    split(group, 0, blocks, body);
+    group.wait();
+}
+
+// Сколько элементов слияния A[0, la) и B[0, lb) берется из A среди первых k
+// элементов результата (при равенстве элементы A идут раньше, как в std::merge)
+template<typename ItA, typename ItB, typename Compare>
+size_t co_rank(size_t k, ItA a, size_t la, ItB b, size_t lb, Compare& comp) {
+    size_t lo = k > lb ? k - lb : 0;
+    size_t hi = k < la ? k : la;
+    while (true) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        if (i > 0 && j < lb && comp(b[j], a[i - 1])) {
+            hi = i - 1;  // Из A взято слишком много
+        } else if (j > 0 && i < la && !comp(b[j - 1], a[i])) {
+            lo = i + 1;  // Из A взято слишком мало
+        } else {
+            return i;
+        }
+    }
+}
+
+// Слияние с перемещением элементов; при равенстве первым идет элемент из [a, a_end)
+template<typename ItA, typename ItB, typename Out, typename Compare>
+void move_merge(ItA a, ItA a_end, ItB b, ItB b_end, Out out, Compare& comp) {
+    while (a != a_end && b != b_end) {
+        if (comp(*b, *a)) {
+            *out = std::move(*b);
+            ++b;
+        } else {
+            *out = std::move(*a);
+            ++a;
+        }
+        ++out;
+    }
+    out = std::move(a, a_end, out);
+    std::move(b, b_end, out);
+}
+
+// Один проход сортировки слиянием: соседние отсортированные серии длины
+// width из src сливаются в dst. Каждое слияние делится на pieces частей
+// по границам, найденным co_rank, чтобы последние проходы тоже были параллельными.
+template<typename Src, typename Dst, typename Compare>
+void merge_pass(Src src, Dst dst, size_t n, size_t width, size_t pieces, Compare& comp, const Options& options) {
+    size_t pairs = (n + 2 * width - 1) / (2 * width);
+    for_blocks(pairs * pieces, options, [&](size_t task) {
+        size_t a0 = task / pieces * 2 * width;
+        size_t piece = task % pieces;
+        size_t a1 = std::min(a0 + width, n);
+        size_t b1 = std::min(a0 + 2 * width, n);
+        size_t la = a1 - a0;
+        size_t lb = b1 - a1;
+        size_t k0 = (la + lb) * piece / pieces;
+        size_t k1 = (la + lb) * (piece + 1) / pieces;
+        size_t i0 = co_rank(k0, src + a0, la, src + a1, lb, comp);
+        size_t i1 = co_rank(k1, src + a0, la, src + a1, lb, comp);
+        move_merge(src + a0 + i0, src + a0 + i1, src + a1 + (k0 - i0), src + a1 + (k1 - i1), dst + a0 + k0, comp);
+    });
+}
+
+} // namespace detail
+
+// Вызов f для каждого элемента
+template<typename RandomIt, typename F, detail::if_iterator<RandomIt> = 0>
+void for_each(RandomIt first, RandomIt last, F f, const Options& options = {}) {
+    size_t n = static_cast<size_t>(last - first);
+    size_t grain = detail::grain_size(n, options);
+    detail::for_blocks(detail::block_count(n, grain), options, [&](size_t block) {
+        RandomIt it = first + block * grain;
+        RandomIt end = first + std::min(n, (block + 1) * grain);
+        for (; it != end; ++it) {
+            f(*it);
+        }
+    });
+}
+
+// Запись f(x) для каждого x из [first, last) в d_first; возвращает конец результата
+template<typename RandomIt, typename OutIt, typename F, detail::if_iterator<RandomIt> = 0>
+OutIt transform(RandomIt first, RandomIt last, OutIt d_first, F f, const Options& options = {}) {
+    size_t n = static_cast<size_t>(last - first);
+    size_t grain = detail::grain_size(n, options);
+    detail::for_blocks(detail::block_count(n, grain), options, [&](size_t block) {
+        size_t begin = block * grain;
+        size_t end = std::min(n, begin + grain);
+        std::transform(first + begin, first + end, d_first + begin, f);
+    });
+    return d_first + n;
+}
+
+// Свертка init op x0 op x1 op ... (op ассоциативна; порядок операндов сохраняется)
+template<typename RandomIt, typename T, typename Op = std::plus<>, detail::if_iterator<RandomIt> = 0>
+T reduce(RandomIt first, RandomIt last, T init, Op op = Op(), const Options& options = {}) {
+    size_t n = static_cast<size_t>(last - first);
+    size_t grain = detail::grain_size(n, options);
+    std::vector<std::optional<T>> partial(detail::block_count(n, grain));
+    detail::for_blocks(partial.size(), options, [&](size_t block) {
+        RandomIt it = first + block * grain;
+        RandomIt end = first + std::min(n, (block + 1) * grain);
+        T acc = *it;
+        for (++it; it != end; ++it) {
+            acc = op(std::move(acc), *it);
+        }
+        partial[block] = std::move(acc);
+    });
+    for (std::optional<T>& value : partial) {
+        init = op(std::move(init), std::move(*value));
+    }
+    return init;
+}
+
+// Количество элементов, удовлетворяющих предикату
+template<typename RandomIt, typename Predicate, detail::if_iterator<RandomIt> = 0>
+size_t count_if(RandomIt first, RandomIt last, Predicate pred, const Options& options = {}) {
+    size_t n = static_cast<size_t>(last - first);
+    size_t grain = detail::grain_size(n, options);
+    std::vector<size_t> counts(detail::block_count(n, grain));
+    detail::for_blocks(counts.size(), options, [&](size_t block) {
+        counts[block] = static_cast<size_t>(
+            std::count_if(first + block * grain, first + std::min(n, (block + 1) * grain), pred));
+    });
+    size_t total = 0;
+    for (size_t count : counts) {
+        total += count;
+    }
+    return total;
+}
+
+// Включающие префиксные суммы: d_first[i] = x0 op x1 op ... op xi.
+// Два прохода: суммы блоков, затем сканирование блоков с переносом
+// от предыдущих. Результат можно писать поверх входа (d_first == first).
+template<typename RandomIt, typename OutIt, typename Op = std::plus<>, detail::if_iterator<RandomIt> = 0>
+OutIt inclusive_scan(RandomIt first, RandomIt last, OutIt d_first, Op op = Op(), const Options& options = {}) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    size_t n = static_cast<size_t>(last - first);
+    size_t grain = detail::grain_size(n, options);
+    size_t blocks = detail::block_count(n, grain);
+
+    std::vector<std::optional<T>> carry(blocks);
+    if (blocks > 1) {
+        // Суммы всех блоков, кроме последнего, превращаются в переносы
+        std::vector<std::optional<T>> sums(blocks - 1);
+        detail::for_blocks(blocks - 1, options, [&](size_t block) {
+            RandomIt it = first + block * grain;
+            RandomIt end = it + grain;
+            T acc = *it;
+            for (++it; it != end; ++it) {
+                acc = op(std::move(acc), *it);
+            }
+            sums[block] = std::move(acc);
+        });
+        carry[1] = std::move(sums[0]);
+        for (size_t block = 2; block < blocks; ++block) {
+            carry[block] = op(*carry[block - 1], std::move(*sums[block - 1]));
+        }
+    }
+
+    detail::for_blocks(blocks, options, [&](size_t block) {
+        size_t begin = block * grain;
+        size_t end = std::min(n, begin + grain);
+        std::optional<T> acc = carry[block];
+        for (size_t i = begin; i < end; ++i) {
+            acc = acc ? op(std::move(*acc), first[i]) : T(first[i]);
+            d_first[i] = *acc;
+        }
+    });
+    return d_first + n;
+}
+
+// Параллельная устойчивая сортировка слиянием: блоки сортируются независимо,
+// затем сливаются попарно за log(число блоков) проходов через буфер.
+// Тип элементов должен быть конструируемым по умолчанию (для буфера).
+template<typename RandomIt, typename Compare = std::less<>, detail::if_iterator<RandomIt> = 0>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare(), const Options& options = {}) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    size_t n = static_cast<size_t>(last - first);
+    size_t grain = detail::grain_size(n, options);
+    size_t blocks = detail::block_count(n, grain);
+
+    detail::for_blocks(blocks, options, [&](size_t block) {
+        std::stable_sort(first + block * grain, first + std::min(n, (block + 1) * grain), comp);
+    });
+    if (blocks <= 1) {
+        return;
+    }
+
+    std::vector<T> buffer(n);
+    size_t threads = detail::pool_of(options).thread_count();
+    bool in_buffer = false;
+    for (size_t width = grain; width < n; width *= 2) {
+        // Пока пар много, каждое слияние - одна задача; на последних
+        // проходах слияния делятся на части, чтобы занять все потоки
+        size_t pairs = (n + 2 * width - 1) / (2 * width);
+        size_t pieces = std::max<size_t>(1, std::min(threads * 4 / pairs, 2 * width / grain));
+        if (in_buffer) {
+            detail::merge_pass(buffer.begin(), first, n, width, pieces, comp, options);
+        } else {
+            detail::merge_pass(first, buffer.begin(), n, width, pieces, comp, options);
+        }
+        in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+        detail::for_blocks(blocks, options, [&](size_t block) {
+            size_t begin = block * grain;
+            size_t end = std::min(n, begin + grain);
+            std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+        });
+    }
+}
+
+// Перегрузки для Vector и std::vector
+
+template<typename C, typename F, detail::if_container<C> = 0>
+void for_each(C& c, F f, const Options& options = {}) {
+    auto data = c.data();
+    parallel::for_each(data, data + c.size(), f, options);
+}
+
+// Результат записывается в out; его размер становится равным размеру in
+template<typename C, typename Out, typename F, detail::if_container<C> = 0>
+void transform(const C& in, Out& out, F f, const Options& options = {}) {
+    out.resize(in.size());
+    auto data = in.data();
+    parallel::transform(data, data + in.size(), out.data(), f, options);
+}
+
+template<typename C, typename T, typename Op = std::plus<>, detail::if_container<C> = 0>
+T reduce(const C& c, T init, Op op = Op(), const Options& options = {}) {
+    auto data = c.data();
+    return parallel::reduce(data, data + c.size(), std::move(init), op, options);
+}
+
+template<typename C, typename Predicate, detail::if_container<C> = 0>
+size_t count_if(const C& c, Predicate pred, const Options& options = {}) {
+    auto data = c.data();
+    return parallel::count_if(data, data + c.size(), pred, options);
+}
+
+// Результат записывается в out; его размер становится равным размеру in
+template<typename C, typename Out, typename Op = std::plus<>, detail::if_container<C> = 0>
+void inclusive_scan(const C& in, Out& out, Op op = Op(), const Options& options = {}) {
+    out.resize(in.size());
+    auto data = in.data();
+    parallel::inclusive_scan(data, data + in.size(), out.data(), op, options);
+}
+
+template<typename C, typename Compare = std::less<>, detail::if_container<C> = 0>
+void sort(C& c, Compare comp = Compare(), const Options& options = {}) {
+    auto data = c.data();
+    parallel::sort(data, data + c.size(), comp, options);
+}
+
+} // namespace parallel
+
+#endif
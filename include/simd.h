@@ -0,0 +1,850 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include "vector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// Векторные ядра для Vector<int>, Vector<float> и Vector<double> (и для
+// любых непрерывных диапазонов этих типов): sum, dot, min/max/minmax, find,
+// count, fill и поэлементные add/mul/fma. Ядра работают с сырыми
+// указателями, без проверок границ на каждом элементе.
+//
+// На x86-64 реализация выбирается во время выполнения по возможностям
+// процессора: AVX-512, AVX2 (+FMA) или SSE2; на остальных платформах и для
+// остальных типов используется последовательный цикл. На буферах,
+// выровненных по ширине регистра (см. AlignedVector в aligned_allocator.h),
+// ядра используют выровненные загрузки и сохранения.
+//
+// Семантика совпадает с последовательным циклом со следующими оговорками:
+// - сумма и скалярное произведение int считаются в long long (с переполнением
+//   по модулю 2^64); для float и double меняется порядок сложений, поэтому
+//   результат может отличаться от цикла в последних разрядах;
+// - fma на AVX2/AVX-512 округляет a*b+c один раз, а не дважды;
+// - поведение min/max на диапазонах с NaN не определено.
+namespace simd {
+
+// Набор инструкций, которым выполняются ядра
+enum class Isa { Scalar, Sse2, Avx2, Avx512 };
+
+inline const char* isa_name(Isa isa) {
+    switch (isa) {
+    case Isa::Sse2:
+        return "SSE2";
+    case Isa::Avx2:
+        return "AVX2";
+    case Isa::Avx512:
+        return "AVX-512";
+    default:
+        return "скалярный";
+    }
+}
+
+// Тип суммы и скалярного произведения: целые накапливаются в 64 битах
+template<typename T>
+using sum_t = std::conditional_t<std::is_integral<T>::value,
+                                 std::conditional_t<std::is_signed<T>::value, long long, unsigned long long>, T>;
+
+namespace detail {
+
+// Типы, для которых есть векторные ядра
+template<typename T>
+struct is_vectorized : std::bool_constant<std::is_same<T, int>::value || std::is_same<T, float>::value ||
+                                          std::is_same<T, double>::value> {};
+
+// Невыводимый контекст: тип значения определяется только по указателю
+template<typename T>
+struct identity {
+    using type = T;
+};
+
+enum class Elementwise { Add, Mul, Fma };
+
+inline unsigned count_trailing_zeros(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    unsigned result = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+// Без -mpopcnt __builtin_popcount - вызов библиотечной функции, поэтому
+// в этом случае биты считаются параллельно в самом регистре
+inline unsigned popcount(uint32_t mask) {
+#if defined(__POPCNT__)
+    return static_cast<unsigned>(__builtin_popcount(mask));
+#else
+    mask = mask - ((mask >> 1) & 0x55555555u);
+    mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+    mask = (mask + (mask >> 4)) & 0x0f0f0f0fu;
+    return static_cast<unsigned>((mask * 0x01010101u) >> 24);
+#endif
+}
+
+// Сложение и умножение целых с переполнением по модулю, как в векторных
+// регистрах (для знаковых типов в обычном цикле это было бы UB)
+template<typename T>
+T wrap_add(T a, T b) {
+    if constexpr (std::is_integral<T>::value) {
+        return static_cast<T>(static_cast<unsigned long long>(a) + static_cast<unsigned long long>(b));
+    } else {
+        return a + b;
+    }
+}
+
+template<typename T>
+T wrap_mul(T a, T b) {
+    if constexpr (std::is_integral<T>::value) {
+        return static_cast<T>(static_cast<unsigned long long>(a) * static_cast<unsigned long long>(b));
+    } else {
+        return a * b;
+    }
+}
+
+template<Elementwise Op, typename T>
+T apply(T a, T b, T c) {
+    if constexpr (Op == Elementwise::Add) {
+        return wrap_add(a, b);
+    } else if constexpr (Op == Elementwise::Mul) {
+        return wrap_mul(a, b);
+    } else {
+        return wrap_add(wrap_mul(a, b), c);
+    }
+}
+
+// Последовательные циклы: запасной путь и хвосты векторных ядер
+struct ScalarKernels {
+    template<typename T>
+    static sum_t<T> sum(const T* p, size_t n) {
+        sum_t<T> total = 0;
+        for (size_t i = 0; i < n; ++i) {
+            total = wrap_add(total, static_cast<sum_t<T>>(p[i]));
+        }
+        return total;
+    }
+
+    template<typename T>
+    static sum_t<T> dot(const T* a, const T* b, size_t n) {
+        sum_t<T> total = 0;
+        for (size_t i = 0; i < n; ++i) {
+            total = wrap_add(total, wrap_mul(static_cast<sum_t<T>>(a[i]), static_cast<sum_t<T>>(b[i])));
+        }
+        return total;
+    }
+
+    // Наименьший и (или) наибольший элемент непустого диапазона
+    template<typename T, bool WantMin, bool WantMax>
+    static std::pair<T, T> bounds(const T* p, size_t n) {
+        T lo = p[0];
+        T hi = p[0];
+        for (size_t i = 1; i < n; ++i) {
+            if (WantMin && p[i] < lo) {
+                lo = p[i];
+            }
+            if (WantMax && hi < p[i]) {
+                hi = p[i];
+            }
+        }
+        return {lo, hi};
+    }
+
+    template<typename T>
+    static size_t find(const T* p, size_t n, T value) {
+        for (size_t i = 0; i < n; ++i) {
+            if (p[i] == value) {
+                return i;
+            }
+        }
+        return n;
+    }
+
+    template<typename T>
+    static size_t count(const T* p, size_t n, T value) {
+        size_t result = 0;
+        for (size_t i = 0; i < n; ++i) {
+            result += p[i] == value;
+        }
+        return result;
+    }
+
+    template<typename T>
+    static void fill(T* p, size_t n, T value) {
+        for (size_t i = 0; i < n; ++i) {
+            p[i] = value;
+        }
+    }
+
+    // out[i] = a[i] op b[i] (для fma: a[i] * b[i] + c[i])
+    template<Elementwise Op, typename T>
+    static void elementwise(const T* a, const T* b, const T* c, T* out, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = apply<Op>(a[i], b[i], c ? c[i] : T());
+        }
+    }
+};
+
+#ifdef SIMD_X86
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+#define SIMD_TARGET_AVX2
+#define SIMD_TARGET_AVX512
+#endif
+
+// Ops<T> каждого набора инструкций - тонкие обертки над встроенными
+// функциями для одного регистра; acc - накопитель суммы (для int - 64-битные
+// дорожки, чтобы сумма не переполнялась)
+
+namespace sse2 {
+
+template<typename T>
+struct Ops;
+
+template<>
+struct Ops<int> {
+    using reg = __m128i;
+    using acc = __m128i;
+    static constexpr size_t width = 4;
+
+    static reg load(const int* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static reg load_aligned(const int* p) { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(int* p, reg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static void store_aligned(int* p, reg v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+    static reg set1(int v) { return _mm_set1_epi32(v); }
+    static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+
+    // В SSE2 нет mullo_epi32: произведения четных и нечетных дорожек
+    // считаются по отдельности, младшие 32 бита собираются обратно
+    static reg mul(reg a, reg b) {
+        __m128i even = _mm_mul_epu32(a, b);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                  _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+
+    static reg fma(reg a, reg b, reg c) { return add(mul(a, b), c); }
+
+    static reg min(reg a, reg b) {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+
+    static reg max(reg a, reg b) {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+
+    static uint32_t eq_mask(reg a, reg b) {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+    }
+
+    static acc acc_zero() { return _mm_setzero_si128(); }
+    static acc acc_merge(acc a, acc b) { return _mm_add_epi64(a, b); }
+
+    // Расширение знаком до 64 бит: старшие половины - маска знака
+    static acc acc_add(acc s, reg v) {
+        __m128i sign = _mm_srai_epi32(v, 31);
+        s = _mm_add_epi64(s, _mm_unpacklo_epi32(v, sign));
+        return _mm_add_epi64(s, _mm_unpackhi_epi32(v, sign));
+    }
+
+    // Знаковое 32x32->64 умножение через беззнаковое: произведение
+    // исправляется на ((a < 0 ? b : 0) + (b < 0 ? a : 0)) << 32
+    static acc acc_dot(acc s, reg a, reg b) {
+        __m128i even = _mm_mul_epu32(a, b);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+        s = _mm_add_epi64(s, _mm_sub_epi64(even, _mm_slli_epi64(fix, 32)));
+        return _mm_add_epi64(s, _mm_sub_epi64(odd, _mm_and_si128(fix, _mm_set_epi32(-1, 0, -1, 0))));
+    }
+
+    static long long acc_reduce(acc s) {
+        alignas(16) long long lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), s);
+        return wrap_add(lanes[0], lanes[1]);
+    }
+};
+
+template<>
+struct Ops<float> {
+    using reg = __m128;
+    using acc = __m128;
+    static constexpr size_t width = 4;
+
+    static reg load(const float* p) { return _mm_loadu_ps(p); }
+    static reg load_aligned(const float* p) { return _mm_load_ps(p); }
+    static void store(float* p, reg v) { _mm_storeu_ps(p, v); }
+    static void store_aligned(float* p, reg v) { _mm_store_ps(p, v); }
+    static reg set1(float v) { return _mm_set1_ps(v); }
+    static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+    static reg fma(reg a, reg b, reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+    static uint32_t eq_mask(reg a, reg b) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+
+    static acc acc_zero() { return _mm_setzero_ps(); }
+    static acc acc_merge(acc a, acc b) { return _mm_add_ps(a, b); }
+    static acc acc_add(acc s, reg v) { return _mm_add_ps(s, v); }
+    static acc acc_dot(acc s, reg a, reg b) { return fma(a, b, s); }
+
+    static float acc_reduce(acc s) {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, s);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+template<>
+struct Ops<double> {
+    using reg = __m128d;
+    using acc = __m128d;
+    static constexpr size_t width = 2;
+
+    static reg load(const double* p) { return _mm_loadu_pd(p); }
+    static reg load_aligned(const double* p) { return _mm_load_pd(p); }
+    static void store(double* p, reg v) { _mm_storeu_pd(p, v); }
+    static void store_aligned(double* p, reg v) { _mm_store_pd(p, v); }
+    static reg set1(double v) { return _mm_set1_pd(v); }
+    static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+    static reg fma(reg a, reg b, reg c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+    static uint32_t eq_mask(reg a, reg b) { return static_cast<uint32_t>(_mm_movemask_pd(_mm_cmpeq_pd(a, b))); }
+
+    static acc acc_zero() { return _mm_setzero_pd(); }
+    static acc acc_merge(acc a, acc b) { return _mm_add_pd(a, b); }
+    static acc acc_add(acc s, reg v) { return _mm_add_pd(s, v); }
+    static acc acc_dot(acc s, reg a, reg b) { return fma(a, b, s); }
+
+    static double acc_reduce(acc s) {
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, s);
+        return lanes[0] + lanes[1];
+    }
+};
+
+#define SIMD_KERNEL_TARGET
+#include "simd_kernels.inc"
+#undef SIMD_KERNEL_TARGET
+
+} // namespace sse2
+
+namespace avx2 {
+
+template<typename T>
+struct Ops;
+
+template<>
+struct Ops<int> {
+    using reg = __m256i;
+    using acc = __m256i;
+    static constexpr size_t width = 8;
+
+    SIMD_TARGET_AVX2 static reg load(const int* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    SIMD_TARGET_AVX2 static reg load_aligned(const int* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+    SIMD_TARGET_AVX2 static void store(int* p, reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    SIMD_TARGET_AVX2 static void store_aligned(int* p, reg v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+    SIMD_TARGET_AVX2 static reg set1(int v) { return _mm256_set1_epi32(v); }
+    SIMD_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_epi32(a, b); }
+    SIMD_TARGET_AVX2 static reg mul(reg a, reg b) { return _mm256_mullo_epi32(a, b); }
+    SIMD_TARGET_AVX2 static reg fma(reg a, reg b, reg c) { return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c); }
+    SIMD_TARGET_AVX2 static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+    SIMD_TARGET_AVX2 static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+
+    SIMD_TARGET_AVX2 static uint32_t eq_mask(reg a, reg b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+
+    SIMD_TARGET_AVX2 static acc acc_zero() { return _mm256_setzero_si256(); }
+    SIMD_TARGET_AVX2 static acc acc_merge(acc a, acc b) { return _mm256_add_epi64(a, b); }
+
+    SIMD_TARGET_AVX2 static acc acc_add(acc s, reg v) {
+        s = _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        return _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+
+    // mul_epi32 перемножает младшие 32 бита 64-битных дорожек со знаком
+    SIMD_TARGET_AVX2 static acc acc_dot(acc s, reg a, reg b) {
+        __m256i lo = _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(a)),
+                                      _mm256_cvtepi32_epi64(_mm256_castsi256_si128(b)));
+        __m256i hi = _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1)),
+                                      _mm256_cvtepi32_epi64(_mm256_extracti128_si256(b, 1)));
+        return _mm256_add_epi64(_mm256_add_epi64(s, lo), hi);
+    }
+
+    SIMD_TARGET_AVX2 static long long acc_reduce(acc s) {
+        alignas(32) long long lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), s);
+        return wrap_add(wrap_add(lanes[0], lanes[1]), wrap_add(lanes[2], lanes[3]));
+    }
+};
+
+template<>
+struct Ops<float> {
+    using reg = __m256;
+    using acc = __m256;
+    static constexpr size_t width = 8;
+
+    SIMD_TARGET_AVX2 static reg load(const float* p) { return _mm256_loadu_ps(p); }
+    SIMD_TARGET_AVX2 static reg load_aligned(const float* p) { return _mm256_load_ps(p); }
+    SIMD_TARGET_AVX2 static void store(float* p, reg v) { _mm256_storeu_ps(p, v); }
+    SIMD_TARGET_AVX2 static void store_aligned(float* p, reg v) { _mm256_store_ps(p, v); }
+    SIMD_TARGET_AVX2 static reg set1(float v) { return _mm256_set1_ps(v); }
+    SIMD_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+    SIMD_TARGET_AVX2 static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+    SIMD_TARGET_AVX2 static reg fma(reg a, reg b, reg c) { return _mm256_fmadd_ps(a, b, c); }
+    SIMD_TARGET_AVX2 static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+    SIMD_TARGET_AVX2 static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+
+    SIMD_TARGET_AVX2 static uint32_t eq_mask(reg a, reg b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+
+    SIMD_TARGET_AVX2 static acc acc_zero() { return _mm256_setzero_ps(); }
+    SIMD_TARGET_AVX2 static acc acc_merge(acc a, acc b) { return _mm256_add_ps(a, b); }
+    SIMD_TARGET_AVX2 static acc acc_add(acc s, reg v) { return _mm256_add_ps(s, v); }
+    SIMD_TARGET_AVX2 static acc acc_dot(acc s, reg a, reg b) { return _mm256_fmadd_ps(a, b, s); }
+
+    SIMD_TARGET_AVX2 static float acc_reduce(acc s) {
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, s);
+        return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+};
+
+template<>
+struct Ops<double> {
+    using reg = __m256d;
+    using acc = __m256d;
+    static constexpr size_t width = 4;
+
+    SIMD_TARGET_AVX2 static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    SIMD_TARGET_AVX2 static reg load_aligned(const double* p) { return _mm256_load_pd(p); }
+    SIMD_TARGET_AVX2 static void store(double* p, reg v) { _mm256_storeu_pd(p, v); }
+    SIMD_TARGET_AVX2 static void store_aligned(double* p, reg v) { _mm256_store_pd(p, v); }
+    SIMD_TARGET_AVX2 static reg set1(double v) { return _mm256_set1_pd(v); }
+    SIMD_TARGET_AVX2 static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    SIMD_TARGET_AVX2 static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    SIMD_TARGET_AVX2 static reg fma(reg a, reg b, reg c) { return _mm256_fmadd_pd(a, b, c); }
+    SIMD_TARGET_AVX2 static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    SIMD_TARGET_AVX2 static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+
+    SIMD_TARGET_AVX2 static uint32_t eq_mask(reg a, reg b) {
+        return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+
+    SIMD_TARGET_AVX2 static acc acc_zero() { return _mm256_setzero_pd(); }
+    SIMD_TARGET_AVX2 static acc acc_merge(acc a, acc b) { return _mm256_add_pd(a, b); }
+    SIMD_TARGET_AVX2 static acc acc_add(acc s, reg v) { return _mm256_add_pd(s, v); }
+    SIMD_TARGET_AVX2 static acc acc_dot(acc s, reg a, reg b) { return _mm256_fmadd_pd(a, b, s); }
+
+    SIMD_TARGET_AVX2 static double acc_reduce(acc s) {
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, s);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+};
+
+#define SIMD_KERNEL_TARGET SIMD_TARGET_AVX2
+#include "simd_kernels.inc"
+#undef SIMD_KERNEL_TARGET
+
+} // namespace avx2
+
+// GCC 12 ложно предупреждает о неинициализированных _mm512_undefined_*
+// внутри встроенных функций AVX-512. Предупреждение выдается там, где
+// функции встраиваются, поэтому подавление охватывает все ядра AVX-512.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace avx512 {
+
+template<typename T>
+struct Ops;
+
+template<>
+struct Ops<int> {
+    using reg = __m512i;
+    using acc = __m512i;
+    static constexpr size_t width = 16;
+
+    SIMD_TARGET_AVX512 static reg load(const int* p) { return _mm512_loadu_si512(p); }
+    SIMD_TARGET_AVX512 static reg load_aligned(const int* p) { return _mm512_load_si512(p); }
+    SIMD_TARGET_AVX512 static void store(int* p, reg v) { _mm512_storeu_si512(p, v); }
+    SIMD_TARGET_AVX512 static void store_aligned(int* p, reg v) { _mm512_store_si512(p, v); }
+    SIMD_TARGET_AVX512 static reg set1(int v) { return _mm512_set1_epi32(v); }
+    SIMD_TARGET_AVX512 static reg add(reg a, reg b) { return _mm512_add_epi32(a, b); }
+    SIMD_TARGET_AVX512 static reg mul(reg a, reg b) { return _mm512_mullo_epi32(a, b); }
+    SIMD_TARGET_AVX512 static reg fma(reg a, reg b, reg c) { return _mm512_add_epi32(_mm512_mullo_epi32(a, b), c); }
+    SIMD_TARGET_AVX512 static reg min(reg a, reg b) { return _mm512_min_epi32(a, b); }
+    SIMD_TARGET_AVX512 static reg max(reg a, reg b) { return _mm512_max_epi32(a, b); }
+    SIMD_TARGET_AVX512 static uint32_t eq_mask(reg a, reg b) { return _mm512_cmpeq_epi32_mask(a, b); }
+
+    SIMD_TARGET_AVX512 static acc acc_zero() { return _mm512_setzero_si512(); }
+    SIMD_TARGET_AVX512 static acc acc_merge(acc a, acc b) { return _mm512_add_epi64(a, b); }
+
+    SIMD_TARGET_AVX512 static acc acc_add(acc s, reg v) {
+        s = _mm512_add_epi64(s, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)));
+        return _mm512_add_epi64(s, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1)));
+    }
+
+    SIMD_TARGET_AVX512 static acc acc_dot(acc s, reg a, reg b) {
+        __m512i lo = _mm512_mul_epi32(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(a)),
+                                      _mm512_cvtepi32_epi64(_mm512_castsi512_si256(b)));
+        __m512i hi = _mm512_mul_epi32(_mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(a, 1)),
+                                      _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(b, 1)));
+        return _mm512_add_epi64(_mm512_add_epi64(s, lo), hi);
+    }
+
+    SIMD_TARGET_AVX512 static long long acc_reduce(acc s) {
+        alignas(64) long long lanes[8];
+        _mm512_store_si512(lanes, s);
+        long long total = 0;
+        for (long long lane : lanes) {
+            total = wrap_add(total, lane);
+        }
+        return total;
+    }
+};
+
+template<>
+struct Ops<float> {
+    using reg = __m512;
+    using acc = __m512;
+    static constexpr size_t width = 16;
+
+    SIMD_TARGET_AVX512 static reg load(const float* p) { return _mm512_loadu_ps(p); }
+    SIMD_TARGET_AVX512 static reg load_aligned(const float* p) { return _mm512_load_ps(p); }
+    SIMD_TARGET_AVX512 static void store(float* p, reg v) { _mm512_storeu_ps(p, v); }
+    SIMD_TARGET_AVX512 static void store_aligned(float* p, reg v) { _mm512_store_ps(p, v); }
+    SIMD_TARGET_AVX512 static reg set1(float v) { return _mm512_set1_ps(v); }
+    SIMD_TARGET_AVX512 static reg add(reg a, reg b) { return _mm512_add_ps(a, b); }
+    SIMD_TARGET_AVX512 static reg mul(reg a, reg b) { return _mm512_mul_ps(a, b); }
+    SIMD_TARGET_AVX512 static reg fma(reg a, reg b, reg c) { return _mm512_fmadd_ps(a, b, c); }
+    SIMD_TARGET_AVX512 static reg min(reg a, reg b) { return _mm512_min_ps(a, b); }
+    SIMD_TARGET_AVX512 static reg max(reg a, reg b) { return _mm512_max_ps(a, b); }
+    SIMD_TARGET_AVX512 static uint32_t eq_mask(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+
+    SIMD_TARGET_AVX512 static acc acc_zero() { return _mm512_setzero_ps(); }
+    SIMD_TARGET_AVX512 static acc acc_merge(acc a, acc b) { return _mm512_add_ps(a, b); }
+    SIMD_TARGET_AVX512 static acc acc_add(acc s, reg v) { return _mm512_add_ps(s, v); }
+    SIMD_TARGET_AVX512 static acc acc_dot(acc s, reg a, reg b) { return _mm512_fmadd_ps(a, b, s); }
+
+    SIMD_TARGET_AVX512 static float acc_reduce(acc s) {
+        alignas(64) float lanes[16];
+        _mm512_store_ps(lanes, s);
+        float total = 0;
+        for (float lane : lanes) {
+            total += lane;
+        }
+        return total;
+    }
+};
+
+template<>
+struct Ops<double> {
+    using reg = __m512d;
+    using acc = __m512d;
+    static constexpr size_t width = 8;
+
+    SIMD_TARGET_AVX512 static reg load(const double* p) { return _mm512_loadu_pd(p); }
+    SIMD_TARGET_AVX512 static reg load_aligned(const double* p) { return _mm512_load_pd(p); }
+    SIMD_TARGET_AVX512 static void store(double* p, reg v) { _mm512_storeu_pd(p, v); }
+    SIMD_TARGET_AVX512 static void store_aligned(double* p, reg v) { _mm512_store_pd(p, v); }
+    SIMD_TARGET_AVX512 static reg set1(double v) { return _mm512_set1_pd(v); }
+    SIMD_TARGET_AVX512 static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+    SIMD_TARGET_AVX512 static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+    SIMD_TARGET_AVX512 static reg fma(reg a, reg b, reg c) { return _mm512_fmadd_pd(a, b, c); }
+    SIMD_TARGET_AVX512 static reg min(reg a, reg b) { return _mm512_min_pd(a, b); }
+    SIMD_TARGET_AVX512 static reg max(reg a, reg b) { return _mm512_max_pd(a, b); }
+    SIMD_TARGET_AVX512 static uint32_t eq_mask(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+
+    SIMD_TARGET_AVX512 static acc acc_zero() { return _mm512_setzero_pd(); }
+    SIMD_TARGET_AVX512 static acc acc_merge(acc a, acc b) { return _mm512_add_pd(a, b); }
+    SIMD_TARGET_AVX512 static acc acc_add(acc s, reg v) { return _mm512_add_pd(s, v); }
+    SIMD_TARGET_AVX512 static acc acc_dot(acc s, reg a, reg b) { return _mm512_fmadd_pd(a, b, s); }
+
+    SIMD_TARGET_AVX512 static double acc_reduce(acc s) {
+        alignas(64) double lanes[8];
+        _mm512_store_pd(lanes, s);
+        double total = 0;
+        for (double lane : lanes) {
+            total += lane;
+        }
+        return total;
+    }
+};
+
+#define SIMD_KERNEL_TARGET SIMD_TARGET_AVX512
+#include "simd_kernels.inc"
+#undef SIMD_KERNEL_TARGET
+
+} // namespace avx512
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // SIMD_X86
+
+// Лучший набор инструкций, поддерживаемый процессором и ОС
+inline Isa detect_isa() {
+#if !defined(SIMD_X86)
+    return Isa::Scalar;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma || max_leaf < 7) {
+        return Isa::Sse2;
+    }
+    // ОС должна сохранять регистры AVX (XMM/YMM) и AVX-512 (opmask, ZMM)
+    unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+    bool avx512f = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6;
+    if (avx2 && avx512f) {
+        return Isa::Avx512;
+    }
+    return avx2 ? Isa::Avx2 : Isa::Sse2;
+#else
+    __builtin_cpu_init();
+    bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (avx2 && __builtin_cpu_supports("avx512f")) {
+        return Isa::Avx512;
+    }
+    return avx2 ? Isa::Avx2 : Isa::Sse2;
+#endif
+}
+
+inline std::atomic<Isa>& active_isa() {
+    static std::atomic<Isa> isa(detect_isa());
+    return isa;
+}
+
+// Вызов f(Kernels) с ядрами выбранного набора инструкций
+template<typename T, typename F>
+auto dispatch(F&& f) {
+#ifdef SIMD_X86
+    if constexpr (is_vectorized<T>::value) {
+        switch (active_isa().load(std::memory_order_relaxed)) {
+        case Isa::Avx512:
+            return f(avx512::Kernels());
+        case Isa::Avx2:
+            return f(avx2::Kernels());
+        case Isa::Sse2:
+            return f(sse2::Kernels());
+        default:
+            break;
+        }
+    }
+#endif
+    return f(ScalarKernels());
+}
+
+inline void check_not_empty(size_t n) {
+    if (n == 0) {
+        throw std::out_of_range("Пустой диапазон");
+    }
+}
+
+template<typename A, typename B>
+void check_same_size(const A& a, const B& b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Размеры векторов не совпадают");
+    }
+}
+
+} // namespace detail
+
+// Набор инструкций, поддерживаемый процессором
+inline Isa detected_isa() {
+    static const Isa isa = detail::detect_isa();
+    return isa;
+}
+
+// Набор инструкций, которым сейчас выполняются ядра
+inline Isa current_isa() {
+    return detail::active_isa().load(std::memory_order_relaxed);
+}
+
+// Принудительный выбор набора инструкций (для проверки и сравнения
+// реализаций); набор должен поддерживаться процессором
+inline void set_isa(Isa isa) {
+    if (isa > detected_isa()) {
+        throw std::invalid_argument("Набор инструкций не поддерживается процессором");
+    }
+    detail::active_isa().store(isa, std::memory_order_relaxed);
+}
+
+// Функции над диапазонами [p, p + n)
+
+template<typename T>
+sum_t<T> sum(const T* p, size_t n) {
+    return detail::dispatch<T>([&](auto kernels) { return kernels.sum(p, n); });
+}
+
+template<typename T>
+sum_t<T> dot(const T* a, const T* b, size_t n) {
+    return detail::dispatch<T>([&](auto kernels) { return kernels.dot(a, b, n); });
+}
+
+template<typename T>
+T min(const T* p, size_t n) {
+    detail::check_not_empty(n);
+    return detail::dispatch<T>([&](auto kernels) { return kernels.template bounds<T, true, false>(p, n); }).first;
+}
+
+template<typename T>
+T max(const T* p, size_t n) {
+    detail::check_not_empty(n);
+    return detail::dispatch<T>([&](auto kernels) { return kernels.template bounds<T, false, true>(p, n); }).second;
+}
+
+template<typename T>
+std::pair<T, T> minmax(const T* p, size_t n) {
+    detail::check_not_empty(n);
+    return detail::dispatch<T>([&](auto kernels) { return kernels.template bounds<T, true, true>(p, n); });
+}
+
+// Индекс первого элемента, равного value, или n, если такого нет
+template<typename T>
+size_t find(const T* p, size_t n, typename detail::identity<T>::type value) {
+    return detail::dispatch<T>([&](auto kernels) { return kernels.find(p, n, value); });
+}
+
+template<typename T>
+size_t count(const T* p, size_t n, typename detail::identity<T>::type value) {
+    return detail::dispatch<T>([&](auto kernels) { return kernels.count(p, n, value); });
+}
+
+template<typename T>
+void fill(T* p, size_t n, typename detail::identity<T>::type value) {
+    detail::dispatch<T>([&](auto kernels) { kernels.fill(p, n, value); });
+}
+
+// Поэлементные операции; out может совпадать с любым из входов
+template<typename T>
+void add(const T* a, const T* b, T* out, size_t n) {
+    detail::dispatch<T>([&](auto kernels) {
+        kernels.template elementwise<detail::Elementwise::Add>(a, b, static_cast<const T*>(nullptr), out, n);
+    });
+}
+
+template<typename T>
+void mul(const T* a, const T* b, T* out, size_t n) {
+    detail::dispatch<T>([&](auto kernels) {
+        kernels.template elementwise<detail::Elementwise::Mul>(a, b, static_cast<const T*>(nullptr), out, n);
+    });
+}
+
+// out[i] = a[i] * b[i] + c[i]
+template<typename T>
+void fma(const T* a, const T* b, const T* c, T* out, size_t n) {
+    detail::dispatch<T>([&](auto kernels) { kernels.template elementwise<detail::Elementwise::Fma>(a, b, c, out, n); });
+}
+
+// Перегрузки для Vector
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+sum_t<T> sum(const Vector<T, Allocator, Stats, Growth>& v) {
+    return simd::sum(v.data(), v.size());
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+sum_t<T> dot(const Vector<T, Allocator, Stats, Growth>& a, const Vector<T, Allocator, Stats, Growth>& b) {
+    detail::check_same_size(a, b);
+    return simd::dot(a.data(), b.data(), a.size());
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+T min(const Vector<T, Allocator, Stats, Growth>& v) {
+    return simd::min(v.data(), v.size());
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+T max(const Vector<T, Allocator, Stats, Growth>& v) {
+    return simd::max(v.data(), v.size());
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+std::pair<T, T> minmax(const Vector<T, Allocator, Stats, Growth>& v) {
+    return simd::minmax(v.data(), v.size());
+}
+
+// Индекс первого элемента, равного value, или v.size()
+template<typename T, typename Allocator, typename Stats, typename Growth>
+size_t find(const Vector<T, Allocator, Stats, Growth>& v, typename detail::identity<T>::type value) {
+    return simd::find(v.data(), v.size(), value);
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+size_t count(const Vector<T, Allocator, Stats, Growth>& v, typename detail::identity<T>::type value) {
+    return simd::count(v.data(), v.size(), value);
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+void fill(Vector<T, Allocator, Stats, Growth>& v, typename detail::identity<T>::type value) {
+    simd::fill(v.data(), v.size(), value);
+}
+
+// Результат записывается в out; его размер становится равным размеру входов
+template<typename T, typename Allocator, typename Stats, typename Growth>
+void add(const Vector<T, Allocator, Stats, Growth>& a, const Vector<T, Allocator, Stats, Growth>& b,
+         Vector<T, Allocator, Stats, Growth>& out) {
+    detail::check_same_size(a, b);
+    out.resize(a.size());
+    simd::add(a.data(), b.data(), out.data(), a.size());
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+void mul(const Vector<T, Allocator, Stats, Growth>& a, const Vector<T, Allocator, Stats, Growth>& b,
+         Vector<T, Allocator, Stats, Growth>& out) {
+    detail::check_same_size(a, b);
+    out.resize(a.size());
+    simd::mul(a.data(), b.data(), out.data(), a.size());
+}
+
+template<typename T, typename Allocator, typename Stats, typename Growth>
+void fma(const Vector<T, Allocator, Stats, Growth>& a, const Vector<T, Allocator, Stats, Growth>& b,
+         const Vector<T, Allocator, Stats, Growth>& c, Vector<T, Allocator, Stats, Growth>& out) {
+    detail::check_same_size(a, b);
+    detail::check_same_size(a, c);
+    out.resize(a.size());
+    simd::fma(a.data(), b.data(), c.data(), out.data(), a.size());
+}
+
+} // namespace simd
+
+#endif
@@ -0,0 +1,394 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "contiguous_iterator.h"
+#include "vector.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Вектор с встроенным буфером на N элементов: пока элементов не больше N,
+// они хранятся внутри самого объекта и куча не используется
+template<typename T, size_t N = 16>
+class SmallVector {
+    static_assert(N > 0, "Размер встроенного буфера должен быть больше нуля");
+
+private:
+    alignas(T) unsigned char inline_buffer[N * sizeof(T)];  // Встроенный буфер
+    T* data_;         // Указатель на текущий буфер (встроенный или в куче)
+    size_t size_;     // Текущее количество элементов
+    size_t capacity_; // Емкость текущего буфера
+
+    static constexpr bool relocatable = is_trivially_relocatable<T>::value;
+
+    T* inline_data() {
+        return reinterpret_cast<T*>(inline_buffer);
+    }
+
+    static void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    // Перенос n элементов в неинициализированную память (исходные уничтожаются)
+    static void relocate(T* src, size_t n, T* dst) {
+        if constexpr (relocatable) {
+            if (n != 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(src[i]));
+                }
+            } catch (...) {
+                destroy(dst, dst + i);
+                throw;
+            }
+            destroy(src, src + n);
+        }
+    }
+
+    // Емкость после удвоения. Емкость не бывает меньше N > 0, но
+    // компилятор этого не видит и без нижней границы предупреждает
+    // о выходе за пределы нулевого буфера (-Warray-bounds)
+    size_t grown_capacity() const {
+        return std::max<size_t>(N, capacity_ * 2);
+    }
+
+    // Освобождение буфера, если он находится в куче
+    void release_heap() {
+        if (!is_inline()) {
+            ::operator delete(data_);
+        }
+    }
+
+    // Перенос элементов в буфер кучи емкостью new_capacity
+    void reallocate(size_t new_capacity) {
+        T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        try {
+            relocate(data_, size_, new_data);
+        } catch (...) {
+            ::operator delete(new_data);
+            throw;
+        }
+        release_heap();
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    // Забирает содержимое other; текущий объект должен быть пустым и встроенным
+    void take(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (other.is_inline()) {
+            // Переносим только занятые элементы встроенного буфера
+            relocate(other.data_, other.size_, data_);
+            size_ = other.size_;
+        } else {
+            // Буфер в куче просто перехватываем
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+        other.size_ = 0;
+    }
+
+    // Замена содержимого count элементами из прямого итератора first:
+    // живым элементам присваиваются новые значения, недостающие
+    // конструируются за ними, лишние уничтожаются. Буфер меняется, только
+    // если count больше емкости.
+    template<typename ForwardIt>
+    void assign_range(ForwardIt first, size_t count) {
+        if (count > capacity_) {
+            clear();
+            reallocate(count);
+        }
+        size_t common = count < size_ ? count : size_;
+        for (size_t i = 0; i < common; ++i, ++first) {
+            data_[i] = *first;
+        }
+        if (count < size_) {
+            destroy(data_ + count, data_ + size_);
+            size_ = count;
+        }
+        for (; size_ < count; ++first) {
+            ::new (static_cast<void*>(data_ + size_)) T(*first);
+            ++size_;
+        }
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = ContiguousIterator<T, SmallVector>;
+    using const_iterator = ContiguousIterator<const T, SmallVector>;
+
+    SmallVector() : data_(inline_data()), size_(0), capacity_(N) {}
+
+    // Копирующий конструктор. Если копирование элемента бросит исключение,
+    // деструктор не вызовется: уже созданные элементы и буфер в куче
+    // освобождаются здесь.
+    SmallVector(const SmallVector& other) : data_(inline_data()), size_(0), capacity_(N) {
+        try {
+            reserve(other.size_);
+            for (size_t i = 0; i < other.size_; ++i) {
+                ::new (static_cast<void*>(data_ + i)) T(other.data_[i]);
+                ++size_;
+            }
+        } catch (...) {
+            clear();
+            release_heap();
+            throw;
+        }
+    }
+
+    // Перемещающий конструктор: копирует только занятую часть встроенного буфера
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : data_(inline_data()), size_(0), capacity_(N) {
+        take(std::move(other));
+    }
+
+    // Копирующий оператор присваивания: текущий буфер (встроенный или в куче)
+    // переиспользуется, если его емкости хватает
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign_range(other.data_, other.size_);
+        }
+        return *this;
+    }
+
+    // Перемещающий оператор присваивания
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            release_heap();
+            data_ = inline_data();
+            capacity_ = N;
+            take(std::move(other));
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        clear();
+        release_heap();
+    }
+
+    // Методы доступа к элементам
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return data_[index];
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        return data_[index];
+    }
+
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return data_[0];
+    }
+
+    const T& front() const {
+        return const_cast<SmallVector&>(*this).front();
+    }
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return data_[size_ - 1];
+    }
+
+    const T& back() const {
+        return const_cast<SmallVector&>(*this).back();
+    }
+
+    // Указатель на текущий буфер (встроенный или в куче)
+    T* data() {
+        return data_;
+    }
+
+    const T* data() const {
+        return data_;
+    }
+
+    // Конструирование элемента на месте в конце
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ >= capacity_) {
+            // Аргументы могут ссылаться на элементы самого вектора
+            T tmp(std::forward<Args>(args)...);
+            reallocate(grown_capacity());
+            ::new (static_cast<void*>(data_ + size_)) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    // Добавление элемента в конец (для l-value)
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    // Добавление элемента в конец (для r-value)
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Удаление последнего элемента
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого вектора");
+        }
+        --size_;
+        data_[size_].~T();
+    }
+
+    // Конструирование элемента на месте в произвольной позиции
+    template<typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        if (pos == size_) {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+
+        T tmp(std::forward<Args>(args)...);
+        if (size_ >= capacity_) {
+            reallocate(grown_capacity());
+        }
+        if constexpr (relocatable) {
+            std::memmove(static_cast<void*>(data_ + pos + 1), static_cast<const void*>(data_ + pos),
+                         (size_ - pos) * sizeof(T));
+            ::new (static_cast<void*>(data_ + pos)) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(data_ + size_)) T(std::move(data_[size_ - 1]));
+            for (size_t i = size_ - 1; i > pos; --i) {
+                data_[i] = std::move(data_[i - 1]);
+            }
+            data_[pos] = std::move(tmp);
+        }
+        ++size_;
+        return data_[pos];
+    }
+
+    // Вставка элемента в произвольную позицию (для l-value)
+    void insert(size_t pos, const T& value) {
+        emplace(pos, value);
+    }
+
+    // Вставка элемента в произвольную позицию (для r-value)
+    void insert(size_t pos, T&& value) {
+        emplace(pos, std::move(value));
+    }
+
+    // Удаление элемента по позиции
+    void erase(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+        if constexpr (relocatable) {
+            data_[pos].~T();
+            std::memmove(static_cast<void*>(data_ + pos), static_cast<const void*>(data_ + pos + 1),
+                         (size_ - pos - 1) * sizeof(T));
+        } else {
+            for (size_t i = pos; i < size_ - 1; ++i) {
+                data_[i] = std::move(data_[i + 1]);
+            }
+            data_[size_ - 1].~T();
+        }
+        --size_;
+    }
+
+    // Замена содержимого элементами диапазона [first, last) с переиспользованием буфера
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        if constexpr (is_forward_iterator<InputIt>::value) {
+            assign_range(first, static_cast<size_t>(std::distance(first, last)));
+        } else {
+            clear();
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    // Резервирование памяти (при new_capacity > N элементы уходят в кучу)
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Удаление всех элементов (буфер сохраняется)
+    void clear() {
+        destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    size_t size() const {
+        return size_;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Хранятся ли элементы во встроенном буфере
+    bool is_inline() const {
+        return data_ == reinterpret_cast<const T*>(inline_buffer);
+    }
+
+    iterator begin() {
+        return iterator(data_);
+    }
+
+    iterator end() {
+        return iterator(data_ + size_);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(data_);
+    }
+
+    const_iterator end() const {
+        return const_iterator(data_ + size_);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif
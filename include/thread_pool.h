@@ -0,0 +1,267 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Пул потоков с перехватом работы (work stealing). У каждого рабочего потока
+// своя очередь задач: свои задачи он берет с конца (последние порожденные,
+// "горячие" в кэше), а простаивающие потоки забирают задачи из начала чужих
+// очередей - это самые крупные, еще не разделенные части работы.
+//
+// Пул на threads потоков запускает threads - 1 рабочих: поток, ожидающий
+// TaskGroup, сам выполняет задачи, поэтому пул на один поток работает
+// последовательно и без переключений.
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+private:
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // Какому пулу и какой очереди принадлежит текущий поток
+    struct WorkerContext {
+        ThreadPool* pool = nullptr;
+        size_t index = 0;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;  // По очереди на рабочий поток (+1 для внешних потоков)
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued;         // Задач в очередях
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    bool stopping;                      // Защищен sleep_mutex
+
+    static WorkerContext& context() {
+        thread_local WorkerContext current;
+        return current;
+    }
+
+    bool pop_own(size_t index, Task& task) {
+        WorkerQueue& q = *queues[index];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty()) {
+            return false;
+        }
+        task = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool steal(size_t thief, Task& task) {
+        size_t count = queues.size();
+        for (size_t i = 1; i <= count; ++i) {
+            WorkerQueue& q = *queues[(thief + i) % count];
+            std::unique_lock<std::mutex> lock(q.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || q.tasks.empty()) {
+                continue;
+            }
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    bool find_task(Task& task) {
+        WorkerContext& ctx = context();
+        if (ctx.pool == this) {
+            return pop_own(ctx.index, task) || steal(ctx.index, task);
+        }
+        return steal(queues.size() - 1, task);
+    }
+
+    void worker_loop(size_t index) {
+        context() = WorkerContext{this, index};
+        Task task;
+        while (true) {
+            if (find_task(task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            wake.wait(lock, [this] { return stopping || queued.load(std::memory_order_relaxed) != 0; });
+            if (stopping && queued.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+        : queued(0), stopping(false) {
+        size_t worker_count = threads > 1 ? threads - 1 : 0;
+        // Последняя очередь - для задач, порожденных внешними потоками
+        for (size_t i = 0; i <= worker_count; ++i) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < worker_count; ++i) {
+            workers.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Общий пул на все аппаратные потоки
+    static ThreadPool& instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // Число потоков, выполняющих задачи (рабочие + ожидающий поток)
+    size_t thread_count() const {
+        return workers.size() + 1;
+    }
+
+    // Постановка задачи в очередь текущего рабочего потока
+    // (для внешнего потока - в общую очередь внешних задач)
+    void submit(Task task) {
+        WorkerContext& ctx = context();
+        size_t index = ctx.pool == this ? ctx.index : queues.size() - 1;
+        queued.fetch_add(1, std::memory_order_relaxed);
+        {
+            WorkerQueue& q = *queues[index];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.tasks.push_back(std::move(task));
+        }
+        if (!workers.empty()) {
+            // Захват мьютекса исключает потерю пробуждения между проверкой
+            // условия в worker_loop и засыпанием
+            { std::lock_guard<std::mutex> lock(sleep_mutex); }
+            wake.notify_one();
+        }
+    }
+
+    // Выполнение одной задачи из очередей пула в текущем потоке.
+    // Возвращает false, если задач нет.
+    bool run_one() {
+        Task task;
+        if (!find_task(task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+};
+
+// Операция отменена через CancellationToken
+class OperationCancelled : public std::runtime_error {
+public:
+    OperationCancelled() : std::runtime_error("Операция отменена") {}
+};
+
+// Флаг отмены, который можно взвести из любого потока
+class CancellationToken {
+private:
+    std::atomic<bool> flag{false};
+
+public:
+    void cancel() {
+        flag.store(true, std::memory_order_relaxed);
+    }
+
+    bool cancelled() const {
+        return flag.load(std::memory_order_relaxed);
+    }
+};
+
+// Группа задач с ожиданием завершения. Первое исключение из задачи
+// отменяет еще не начатые задачи группы и пробрасывается из wait().
+class TaskGroup {
+private:
+    ThreadPool& pool;
+    const CancellationToken* token;  // Внешний флаг отмены (может отсутствовать)
+    std::atomic<size_t> pending;     // Поставленные и еще не завершенные задачи
+    std::atomic<bool> failed;
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+public:
+    explicit TaskGroup(ThreadPool& thread_pool, const CancellationToken* cancellation = nullptr)
+        : pool(thread_pool), token(cancellation), pending(0), failed(false) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        // Задачи ссылаются на группу: дожидаемся их, даже если wait() не вызван
+        while (pending.load(std::memory_order_acquire) != 0) {
+            if (!pool.run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // Пора ли прекращать работу: внешняя отмена или ошибка в другой задаче
+    bool stop_requested() const {
+        return failed.load(std::memory_order_relaxed) || (token && token->cancelled());
+    }
+
+    template<typename F>
+    void run(F&& f) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        pool.submit([this, task = std::forward<F>(f)]() mutable {
+            if (!stop_requested()) {
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            pending.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // Ожидание всех задач; ожидающий поток сам выполняет задачи пула.
+    // Бросает первое исключение задач или OperationCancelled при отмене.
+    void wait() {
+        while (pending.load(std::memory_order_acquire) != 0) {
+            if (!pool.run_one()) {
+                std::this_thread::yield();
+            }
+        }
+        if (error) {
+            std::exception_ptr e = error;
+            error = nullptr;
+            failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(e);
+        }
+        if (token && token->cancelled()) {
+            throw OperationCancelled();
+        }
+    }
+};
+
+#endif
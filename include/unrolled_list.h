@@ -0,0 +1,611 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include "vector.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Развернутый список: двусвязный список блоков, каждый из которых хранит
+// до ChunkSize элементов подряд. Обход идет почти со скоростью Vector
+// (один промах кэша на блок, а не на элемент), а вставка и удаление в середине
+// сдвигают элементы только внутри одного блока.
+template<typename T,
+         size_t ChunkSize = (sizeof(T) <= 64 ? 256 / sizeof(T) : 4),
+         typename Allocator = std::allocator<T>>
+class UnrolledList {
+    static_assert(ChunkSize >= 2, "Блок должен вмещать хотя бы два элемента");
+
+private:
+    struct Chunk {
+        alignas(T) unsigned char storage[ChunkSize * sizeof(T)];  // Элементы блока
+        size_t count;   // Количество занятых слотов
+        Chunk* prev;    // Предыдущий блок
+        Chunk* next;    // Следующий блок
+
+        Chunk() : count(0), prev(nullptr), next(nullptr) {}
+
+        T* items() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    using ChunkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+    using ChunkTraits = std::allocator_traits<ChunkAllocator>;
+
+    static constexpr bool relocatable = is_trivially_relocatable<T>::value;
+
+    Chunk* head;     // Первый блок
+    Chunk* tail;     // Последний блок
+    size_t size_;    // Общее количество элементов
+    ChunkAllocator alloc;  // Аллокатор блоков
+
+    Chunk* create_chunk() {
+        Chunk* chunk = ChunkTraits::allocate(alloc, 1);
+        ChunkTraits::construct(alloc, chunk);
+        return chunk;
+    }
+
+    // Освобождение блока (элементы должны быть уже уничтожены или перенесены)
+    void destroy_chunk(Chunk* chunk) {
+        ChunkTraits::destroy(alloc, chunk);
+        ChunkTraits::deallocate(alloc, chunk, 1);
+    }
+
+    template<typename... Args>
+    void construct(T* p, Args&&... args) {
+        ChunkTraits::construct(alloc, p, std::forward<Args>(args)...);
+    }
+
+    void destroy_items(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                ChunkTraits::destroy(alloc, first);
+            }
+        }
+    }
+
+    // Перенос n элементов в неинициализированную память dst (области не перекрываются).
+    // Исходные элементы уничтожаются, только когда построены все новые; при
+    // исключении src остается целым, а построенное в dst уничтожается.
+    void relocate(T* src, size_t n, T* dst) {
+        if constexpr (relocatable) {
+            if (n != 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+        } else {
+            size_t i = 0;
+            try {
+                // Перемещаем, только если перемещение не бросает исключений,
+                // иначе копируем, чтобы исходный блок остался целым
+                for (; i < n; ++i) {
+                    construct(dst + i, std::move_if_noexcept(src[i]));
+                }
+            } catch (...) {
+                destroy_items(dst, dst + i);
+                throw;
+            }
+            destroy_items(src, src + n);
+        }
+    }
+
+    // Вставка нового блока после pos (pos == nullptr - в начало)
+    Chunk* link_chunk_after(Chunk* pos) {
+        Chunk* chunk = create_chunk();
+        chunk->prev = pos;
+        chunk->next = pos ? pos->next : head;
+        if (chunk->next) {
+            chunk->next->prev = chunk;
+        } else {
+            tail = chunk;
+        }
+        if (pos) {
+            pos->next = chunk;
+        } else {
+            head = chunk;
+        }
+        return chunk;
+    }
+
+    // Исключение пустого блока из списка
+    void unlink_chunk(Chunk* chunk) {
+        if (chunk->prev) {
+            chunk->prev->next = chunk->next;
+        } else {
+            head = chunk->next;
+        }
+        if (chunk->next) {
+            chunk->next->prev = chunk->prev;
+        } else {
+            tail = chunk->prev;
+        }
+        destroy_chunk(chunk);
+    }
+
+    // Конструирование элемента в позиции index блока (в блоке есть свободный слот)
+    template<typename... Args>
+    T& emplace_in_chunk(Chunk* chunk, size_t index, Args&&... args) {
+        T* items = chunk->items();
+        if (index == chunk->count) {
+            construct(items + index, std::forward<Args>(args)...);
+        } else {
+            T tmp(std::forward<Args>(args)...);
+            if constexpr (relocatable) {
+                std::memmove(static_cast<void*>(items + index + 1), static_cast<const void*>(items + index),
+                             (chunk->count - index) * sizeof(T));
+                construct(items + index, std::move(tmp));
+            } else {
+                // Новый последний элемент сразу учитывается в блоке: если
+                // присваивание при сдвиге бросит исключение, он не потеряется
+                construct(items + chunk->count, std::move(items[chunk->count - 1]));
+                ++chunk->count;
+                ++size_;
+                for (size_t i = chunk->count - 2; i > index; --i) {
+                    items[i] = std::move(items[i - 1]);
+                }
+                items[index] = std::move(tmp);
+                return items[index];
+            }
+        }
+        ++chunk->count;
+        ++size_;
+        return items[index];
+    }
+
+    // Конструирование первого элемента только что добавленного блока. Если
+    // конструктор бросит исключение, пустой блок убирается из списка: иначе
+    // итератор на нем не остановится, а begin() != end() при size() == 0.
+    template<typename... Args>
+    T& emplace_in_new_chunk(Chunk* chunk, Args&&... args) {
+        try {
+            return emplace_in_chunk(chunk, 0, std::forward<Args>(args)...);
+        } catch (...) {
+            unlink_chunk(chunk);
+            throw;
+        }
+    }
+
+    // Удаление элемента index из блока со сдвигом хвоста блока
+    void erase_in_chunk(Chunk* chunk, size_t index) {
+        T* items = chunk->items();
+        if constexpr (relocatable) {
+            ChunkTraits::destroy(alloc, items + index);
+            std::memmove(static_cast<void*>(items + index), static_cast<const void*>(items + index + 1),
+                         (chunk->count - index - 1) * sizeof(T));
+        } else {
+            for (size_t i = index; i + 1 < chunk->count; ++i) {
+                items[i] = std::move(items[i + 1]);
+            }
+            ChunkTraits::destroy(alloc, items + chunk->count - 1);
+        }
+        --chunk->count;
+        --size_;
+    }
+
+    // Разбиение заполненного блока: верхняя половина переходит в новый блок
+    Chunk* split(Chunk* chunk) {
+        Chunk* right = link_chunk_after(chunk);
+        size_t keep = chunk->count / 2;
+        try {
+            relocate(chunk->items() + keep, chunk->count - keep, right->items());
+        } catch (...) {
+            unlink_chunk(right);
+            throw;
+        }
+        right->count = chunk->count - keep;
+        chunk->count = keep;
+        return right;
+    }
+
+    // Слияние блока со следующим, если вместе они помещаются в один блок
+    void merge_with_next(Chunk* chunk) {
+        Chunk* next = chunk->next;
+        if (next && chunk->count + next->count <= ChunkSize) {
+            relocate(next->items(), next->count, chunk->items() + chunk->count);
+            chunk->count += next->count;
+            next->count = 0;
+            unlink_chunk(next);
+        }
+    }
+
+    // Поиск блока, содержащего позицию pos. В index возвращается смещение внутри блока.
+    // Проход идет от ближайшего конца списка.
+    Chunk* locate(size_t pos, size_t& index) const {
+        if (pos < size_ / 2) {
+            Chunk* chunk = head;
+            while (pos >= chunk->count) {
+                pos -= chunk->count;
+                chunk = chunk->next;
+            }
+            index = pos;
+            return chunk;
+        }
+        size_t remaining = size_ - pos;  // Сколько элементов от pos до конца
+        Chunk* chunk = tail;
+        while (remaining > chunk->count) {
+            remaining -= chunk->count;
+            chunk = chunk->prev;
+        }
+        index = chunk->count - remaining;
+        return chunk;
+    }
+
+    void copy_from(const UnrolledList& other) {
+        for (Chunk* chunk = other.head; chunk; chunk = chunk->next) {
+            Chunk* copy = link_chunk_after(tail);
+            try {
+                for (size_t i = 0; i < chunk->count; ++i) {
+                    construct(copy->items() + i, chunk->items()[i]);
+                    ++copy->count;
+                    ++size_;
+                }
+            } catch (...) {
+                // Пустой блок в списке не оставляем: итератор на нем не остановится
+                if (copy->count == 0) {
+                    unlink_chunk(copy);
+                }
+                throw;
+            }
+        }
+    }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    UnrolledList() : head(nullptr), tail(nullptr), size_(0), alloc() {}
+
+    explicit UnrolledList(const Allocator& allocator) : head(nullptr), tail(nullptr), size_(0), alloc(allocator) {}
+
+    // Копирующий конструктор
+    UnrolledList(const UnrolledList& other)
+        : head(nullptr), tail(nullptr), size_(0),
+          alloc(ChunkTraits::select_on_container_copy_construction(other.alloc)) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    // Перемещающий конструктор
+    UnrolledList(UnrolledList&& other) noexcept
+        : head(other.head), tail(other.tail), size_(other.size_), alloc(std::move(other.alloc)) {
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size_ = 0;
+    }
+
+    // Копирующий оператор присваивания
+    UnrolledList& operator=(const UnrolledList& other) {
+        if (this != &other) {
+            if constexpr (ChunkTraits::propagate_on_container_copy_assignment::value) {
+                // Блоки, выделенные другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    clear();
+                }
+                alloc = other.alloc;
+            }
+            // Существующие блоки переиспользуются, создаются только недостающие
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // Перемещающий оператор присваивания
+    UnrolledList& operator=(UnrolledList&& other) noexcept(ChunkTraits::propagate_on_container_move_assignment::value ||
+                                                           ChunkTraits::is_always_equal::value) {
+        if (this != &other) {
+            clear();
+            if constexpr (ChunkTraits::propagate_on_container_move_assignment::value) {
+                alloc = std::move(other.alloc);
+            } else if (!(alloc == other.alloc)) {
+                // Блоки чужого аллокатора перехватить нельзя: перемещаем элементы
+                for (Chunk* chunk = other.head; chunk; chunk = chunk->next) {
+                    for (size_t i = 0; i < chunk->count; ++i) {
+                        push_back(std::move(chunk->items()[i]));
+                    }
+                }
+                other.clear();
+                return *this;
+            }
+            head = other.head;
+            tail = other.tail;
+            size_ = other.size_;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~UnrolledList() {
+        clear();
+    }
+
+    // Очистка списка: освобождение идет поблочно
+    void clear() {
+        while (head) {
+            Chunk* chunk = head;
+            head = head->next;
+            destroy_items(chunk->items(), chunk->items() + chunk->count);
+            destroy_chunk(chunk);
+        }
+        tail = nullptr;
+        size_ = 0;
+    }
+
+    // Замена содержимого элементами диапазона [first, last). Существующие
+    // блоки заполняются по порядку: живым элементам присваиваются новые
+    // значения, свободные слоты блока занимаются новыми элементами, поэтому
+    // результат плотно упакован, как после копирования. Лишние блоки
+    // освобождаются, недостающие добавляются в конец. Диапазон не должен
+    // указывать на элементы самого списка.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        Chunk* chunk = head;
+        for (; chunk && first != last; chunk = chunk->next) {
+            T* items = chunk->items();
+            size_t i = 0;
+            for (; i < chunk->count && first != last; ++i, ++first) {
+                items[i] = *first;
+            }
+            destroy_items(items + i, items + chunk->count);
+            size_ -= chunk->count - i;
+            chunk->count = i;
+            for (; chunk->count < ChunkSize && first != last; ++first) {
+                construct(items + chunk->count, *first);
+                ++chunk->count;
+                ++size_;
+            }
+        }
+        while (chunk) {
+            Chunk* next = chunk->next;
+            destroy_items(chunk->items(), chunk->items() + chunk->count);
+            size_ -= chunk->count;
+            chunk->count = 0;
+            unlink_chunk(chunk);
+            chunk = next;
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Конструирование элемента на месте в конце списка
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        // Заполненный последний блок не разбиваем: последовательное добавление
+        // оставляет все блоки полностью заполненными
+        if (tail && tail->count < ChunkSize) {
+            return emplace_in_chunk(tail, tail->count, std::forward<Args>(args)...);
+        }
+        Chunk* chunk = link_chunk_after(tail);
+        return emplace_in_new_chunk(chunk, std::forward<Args>(args)...);
+    }
+
+    // Добавление элемента в конец списка (для l-value)
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    // Добавление элемента в конец списка (для r-value)
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Конструирование элемента на месте в начале списка
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (head && head->count < ChunkSize) {
+            return emplace_in_chunk(head, 0, std::forward<Args>(args)...);
+        }
+        Chunk* chunk = link_chunk_after(nullptr);
+        return emplace_in_new_chunk(chunk, std::forward<Args>(args)...);
+    }
+
+    // Добавление элемента в начало списка (для l-value)
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    // Добавление элемента в начало списка (для r-value)
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    // Конструирование элемента в произвольной позиции
+    template<typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        if (pos == size_) {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+
+        size_t index;
+        Chunk* chunk = locate(pos, index);
+        if (chunk->count == ChunkSize) {
+            // Блок заполнен: делим его пополам и вставляем в нужную половину
+            Chunk* right = split(chunk);
+            if (index > chunk->count) {
+                index -= chunk->count;
+                chunk = right;
+            }
+        }
+        return emplace_in_chunk(chunk, index, std::forward<Args>(args)...);
+    }
+
+    // Вставка элемента в произвольную позицию (для l-value)
+    void insert(size_t pos, const T& value) {
+        emplace(pos, value);
+    }
+
+    // Вставка элемента в произвольную позицию (для r-value)
+    void insert(size_t pos, T&& value) {
+        emplace(pos, std::move(value));
+    }
+
+    // Удаление элемента по позиции
+    void erase(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Позиция удаления вне диапазона");
+        }
+
+        size_t index;
+        Chunk* chunk = locate(pos, index);
+        erase_in_chunk(chunk, index);
+
+        if (chunk->count == 0) {
+            unlink_chunk(chunk);
+        } else if (chunk->count < ChunkSize / 2) {
+            // Блок заполнен меньше чем наполовину: пробуем слить его с соседом,
+            // чтобы список не вырождался в обычный список из полупустых блоков
+            if (chunk->prev && chunk->prev->count + chunk->count <= ChunkSize) {
+                merge_with_next(chunk->prev);
+            } else {
+                merge_with_next(chunk);
+            }
+        }
+    }
+
+    // Доступ к элементу по индексу за O(n / ChunkSize)
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        size_t offset;
+        Chunk* chunk = locate(index, offset);
+        return chunk->items()[offset];
+    }
+
+    const T& operator[](size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Индекс вне диапазона");
+        }
+        size_t offset;
+        Chunk* chunk = locate(index, offset);
+        return chunk->items()[offset];
+    }
+
+    // Получение количества элементов в списке
+    size_t size() const {
+        return size_;
+    }
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Количество блоков (для оценки заполненности)
+    size_t chunk_count() const {
+        size_t count = 0;
+        for (Chunk* chunk = head; chunk; chunk = chunk->next) {
+            ++count;
+        }
+        return count;
+    }
+
+    Allocator get_allocator() const {
+        return Allocator(alloc);
+    }
+
+    // Итератор (однонаправленный): блок и позиция внутри блока;
+    // const_iterator дает доступ к элементам только на чтение
+    template<bool Const>
+    class basic_iterator {
+    private:
+        template<bool>
+        friend class basic_iterator;
+
+        Chunk* chunk;   // Текущий блок (nullptr - конец списка)
+        size_t index;   // Позиция внутри блока
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : chunk(nullptr), index(0) {}
+
+        basic_iterator(Chunk* c, size_t i) : chunk(c), index(i) {}
+
+        // Преобразование iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) : chunk(other.chunk), index(other.index) {}
+
+        reference operator*() const {
+            return chunk->items()[index];
+        }
+
+        pointer operator->() const {
+            return chunk->items() + index;
+        }
+
+        // Префиксный инкремент: внутри блока - просто сдвиг индекса
+        basic_iterator& operator++() {
+            if (++index == chunk->count) {
+                chunk = chunk->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return a.chunk == b.chunk && a.index == b.index;
+        }
+
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return !(a == b);
+        }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    iterator begin() {
+        return iterator(head, 0);
+    }
+
+    iterator end() {
+        return iterator(nullptr, 0);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(head, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(nullptr, 0);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+};
+
+#endif
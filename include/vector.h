@@ -1,248 +1,947 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include "container_stats.h"
+#include "contiguous_iterator.h"
+#include "growth_policy.h"
+#include "index_set.h"
+
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+// Признак "тривиально перемещаемого" типа: объект можно перенести в другую
+// область памяти побайтовым копированием, не вызывая конструктор перемещения
+// и деструктор. По умолчанию это тривиально копируемые типы; для своих типов
+// (например, хранящих только указатели на кучу) признак можно специализировать.
 template<typename T>
-class Vector {
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Признак прямого (многопроходного) итератора: для таких диапазонов длину
+// можно узнать заранее и выделить память один раз
+template<typename It, typename = void>
+struct is_forward_iterator : std::false_type {};
+
+template<typename It>
+struct is_forward_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category> {};
+
+// Признак аллокатора, умеющего менять размер уже выделенного буфера
+// с сохранением содержимого: a.reallocate(p, old_n, new_n) (см. MmapAllocator)
+template<typename Allocator, typename = void>
+struct has_reallocate : std::false_type {};
+
+template<typename Allocator>
+struct has_reallocate<Allocator, std::void_t<decltype(std::declval<Allocator&>().reallocate(
+    std::declval<typename Allocator::value_type*>(), size_t(), size_t()))>> : std::true_type {};
+
+// Stats - политика статистики (NoStats или ContainerStats, см. container_stats.h)
+// Growth - политика роста емкости (см. growth_policy.h)
+template<typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats,
+         typename Growth = DoublingGrowth>
+class Vector : private Stats {
 private:
-    T* data;        // Указатель на динамически выделенный массив элементов
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    T* data_;       // Указатель на неинициализированный буфер элементов
     size_t size_;   // Текущее количество элементов в векторе
     size_t capacity_; // Максимальное количество элементов, которое может храниться
-    
+    Allocator alloc;  // Аллокатор буфера
+
+    static constexpr bool relocatable = is_trivially_relocatable<T>::value;
+    // Буфер растет средствами аллокатора, без выделения нового и переноса
+    static constexpr bool resizable_in_place = relocatable && has_reallocate<Allocator>::value;
+
+    // Выделение "сырой" памяти без конструирования элементов
+    T* allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        T* p = AllocTraits::allocate(alloc, n);
+        Stats::on_allocate(n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (p) {
+            AllocTraits::deallocate(alloc, p, n);
+            Stats::on_deallocate(n * sizeof(T));
+        }
+    }
+
+    // Конструирование элемента в неинициализированной памяти через аллокатор
+    template<typename... Args>
+    void construct(T* p, Args&&... args) {
+        AllocTraits::construct(alloc, p, std::forward<Args>(args)...);
+        count_construction<T, Args&&...>(static_cast<Stats&>(*this));
+    }
+
+    // Присваивание существующему элементу (с учетом в статистике)
+    template<typename U>
+    void assign_element(T& dst, U&& src) {
+        dst = std::forward<U>(src);
+        count_assignment<T, U&&>(static_cast<Stats&>(*this));
+    }
+
+    // Побайтовый сдвиг n элементов (области могут перекрываться)
+    void move_bytes(T* dst, const T* src, size_t n) {
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        Stats::on_relocate(n);
+    }
+
+    void destroy_one(T* p) {
+        AllocTraits::destroy(alloc, p);
+    }
+
+    // Вызов деструкторов для диапазона [first, last)
+    void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                destroy_one(first);
+            }
+        }
+    }
+
+    // Перенос n элементов из src в неинициализированную память dst.
+    // После вызова элементы src считаются уничтоженными.
+    void relocate(T* src, size_t n, T* dst) {
+        if constexpr (relocatable) {
+            if (n != 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+                Stats::on_relocate(n);
+            }
+        } else {
+            transfer(src, n, dst);
+            destroy(src, src + n);
+        }
+    }
+
+    // Построение в dst n элементов из src без уничтожения исходных.
+    // Перемещаем, только если перемещение не бросает исключений, иначе
+    // копируем, чтобы при исключении src остался целым (построенное в dst
+    // в этом случае уничтожается).
+    void transfer(T* src, size_t n, T* dst) {
+        size_t i = 0;
+        try {
+            for (; i < n; ++i) {
+                construct(dst + i, std::move_if_noexcept(src[i]));
+            }
+        } catch (...) {
+            destroy(dst, dst + i);
+            throw;
+        }
+    }
+
+    // Перенос всех элементов в new_data с "дыркой" из gap слотов перед pos.
+    // Старые элементы уничтожаются, только когда построены обе части; при
+    // исключении уничтожается лишь построенное в new_data, старый буфер цел.
+    void relocate_around(T* new_data, size_t pos, size_t gap) {
+        if constexpr (relocatable) {
+            relocate(data_, pos, new_data);
+            relocate(data_ + pos, size_ - pos, new_data + pos + gap);
+        } else {
+            transfer(data_, pos, new_data);
+            try {
+                transfer(data_ + pos, size_ - pos, new_data + pos + gap);
+            } catch (...) {
+                destroy(new_data, new_data + pos);
+                throw;
+            }
+            destroy(data_, data_ + size_);
+        }
+    }
+
     // Приватный метод для перевыделения памяти с новым capacity
     void reallocate(size_t new_capacity) {
-        T* new_data = new T[new_capacity];  // Выделяем новый массив
-        
-        // Перемещаем элементы из старого массива в новый
-        for (size_t i = 0; i < size_; ++i) {
-            new_data[i] = std::move(data[i]); 
-        }
-        
-        delete[] data;      // Освобождаем старый массив
-        data = new_data;    // Обновляем указатель
+        if constexpr (resizable_in_place) {
+            if (data_) {
+                data_ = alloc.reallocate(data_, capacity_, new_capacity);
+                Stats::on_reallocate();
+                Stats::on_deallocate(capacity_ * sizeof(T));
+                Stats::on_allocate(new_capacity * sizeof(T));
+                capacity_ = new_capacity;
+                return;
+            }
+        }
+
+        T* new_data = allocate(new_capacity);  // Выделяем новый буфер
+        Stats::on_reallocate();
+
+        try {
+            relocate(data_, size_, new_data);   // Переносим элементы
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+
+        deallocate(data_, capacity_);   // Освобождаем старый буфер
+        data_ = new_data;   // Обновляем указатель
         capacity_ = new_capacity;  // Обновляем емкость
     }
-    
+
+    // Освобождение своего буфера и перехват буфера other
+    void take_buffer(Vector& other) noexcept {
+        clear();
+        deallocate(data_, capacity_);
+
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+
+        // Обнуляем указатели исходного вектора
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    // Новая емкость по политике роста, но не меньше required
+    size_t next_capacity(size_t required) const {
+        size_t new_capacity = Growth::next_capacity(capacity_, required, sizeof(T));
+        return new_capacity < required ? required : new_capacity;
+    }
+
+    // Вставка count элементов из прямого итератора first перед позицией pos
+    template<typename ForwardIt>
+    void insert_range(size_t pos, ForwardIt first, size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        if constexpr (resizable_in_place) {
+            // Буфер расширяется на месте, дальше - обычный сдвиг хвоста
+            if (size_ + count > capacity_) {
+                reallocate(next_capacity(size_ + count));
+            }
+        }
+
+        if (size_ + count > capacity_) {
+            // Один раз выделяем буфер нужного размера: новые элементы
+            // конструируются сразу на своих местах, старые переносятся вокруг них
+            size_t new_capacity = next_capacity(size_ + count);
+            T* new_data = allocate(new_capacity);
+            Stats::on_reallocate();
+            size_t built = 0;
+            try {
+                for (; built < count; ++built, ++first) {
+                    construct(new_data + pos + built, *first);
+                }
+            } catch (...) {
+                destroy(new_data + pos, new_data + pos + built);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate_around(new_data, pos, count);
+            } catch (...) {
+                destroy(new_data + pos, new_data + pos + count);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            size_ += count;
+            return;
+        }
+
+        size_t tail = size_ - pos;
+        if constexpr (relocatable) {
+            // Сдвигаем хвост на count позиций одним memmove
+            move_bytes(data_ + pos + count, data_ + pos, tail);
+            size_t built = 0;
+            try {
+                for (; built < count; ++built, ++first) {
+                    construct(data_ + pos + built, *first);
+                }
+            } catch (...) {
+                // Закрываем "дырку", возвращая хвост на место
+                destroy(data_ + pos, data_ + pos + built);
+                move_bytes(data_ + pos, data_ + pos + count, tail);
+                throw;
+            }
+            size_ += count;
+        } else if (tail > count) {
+            // Последние count элементов переносим в неинициализированную
+            // память, остальную часть хвоста сдвигаем присваиванием
+            for (size_t i = size_ - count; i < size_; ++i) {
+                construct(data_ + i + count, std::move(data_[i]));
+            }
+            size_t old_size = size_;
+            size_ += count;
+            for (size_t i = old_size - count; i > pos; --i) {
+                assign_element(data_[i - 1 + count], std::move(data_[i - 1]));
+            }
+            for (size_t i = 0; i < count; ++i, ++first) {
+                assign_element(data_[pos + i], *first);
+            }
+        } else {
+            // Хвост короче вставляемого диапазона: часть новых элементов
+            // конструируется за концом, хвост переносится за них целиком
+            ForwardIt mid = first;
+            std::advance(mid, tail);
+            size_t old_size = size_;
+            for (ForwardIt it = mid; size_ < old_size + count - tail; ++it) {
+                construct(data_ + size_, *it);
+                ++size_;
+            }
+            for (size_t i = pos; i < old_size; ++i) {
+                construct(data_ + i + count, std::move(data_[i]));
+                ++size_;
+            }
+            for (size_t i = pos; i < old_size; ++i, ++first) {
+                assign_element(data_[i], *first);
+            }
+        }
+    }
+
+    // Замена содержимого count элементами из прямого итератора first.
+    // Если емкости хватает, живым элементам присваиваются новые значения,
+    // недостающие конструируются за ними, лишние уничтожаются - без
+    // обращений к аллокатору. Иначе новый буфер ровно на count элементов
+    // заполняется до освобождения старого.
+    template<typename ForwardIt>
+    void assign_range(ForwardIt first, size_t count) {
+        if (count > capacity_) {
+            T* new_data = allocate(count);
+            Stats::on_reallocate();
+            size_t built = 0;
+            try {
+                for (; built < count; ++built, ++first) {
+                    construct(new_data + built, *first);
+                }
+            } catch (...) {
+                destroy(new_data, new_data + built);
+                deallocate(new_data, count);
+                throw;
+            }
+            clear();
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            size_ = count;
+            capacity_ = count;
+            return;
+        }
+
+        size_t common = count < size_ ? count : size_;
+        for (size_t i = 0; i < common; ++i, ++first) {
+            assign_element(data_[i], *first);
+        }
+        if (count < size_) {
+            destroy(data_ + count, data_ + size_);
+            size_ = count;
+        }
+        for (; size_ < count; ++first) {
+            construct(data_ + size_, *first);
+            ++size_;
+        }
+    }
+
+    // Удаление элементов, для индексов которых erase(i) истинно, за один
+    // проход со сжатием. Возвращает количество удаленных элементов.
+    template<typename IndexPredicate>
+    size_t erase_where(IndexPredicate erase) {
+        size_t write = 0;
+
+        if constexpr (relocatable) {
+            // Оставляемые элементы переносим целыми сериями через memmove
+            size_t run_start = 0;
+            for (size_t i = 0; i < size_; ++i) {
+                if (erase(i)) {
+                    if (run_start != i && write != run_start) {
+                        move_bytes(data_ + write, data_ + run_start, i - run_start);
+                    }
+                    write += i - run_start;
+                    destroy_one(data_ + i);
+                    run_start = i + 1;
+                }
+            }
+            if (run_start != size_ && write != run_start) {
+                move_bytes(data_ + write, data_ + run_start, size_ - run_start);
+            }
+            write += size_ - run_start;
+        } else {
+            for (size_t i = 0; i < size_; ++i) {
+                if (!erase(i)) {
+                    if (write != i) {
+                        assign_element(data_[write], std::move(data_[i]));
+                    }
+                    ++write;
+                }
+            }
+            destroy(data_ + write, data_ + size_);
+        }
+
+        size_t removed = size_ - write;
+        size_ = write;
+        return removed;
+    }
+
 public:
-    Vector() : data(nullptr), size_(0), capacity_(0) {}
-    
-    // Конструктор с указанием начального размера
-    Vector(size_t initial_size) : size_(initial_size), capacity_(initial_size) {
-        data = new T[capacity_];  // Выделяем память под указанное количество элементов
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = ContiguousIterator<T, Vector>;
+    using const_iterator = ContiguousIterator<const T, Vector>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    Vector() : data_(nullptr), size_(0), capacity_(0), alloc() {}
+
+    // Пустой вектор с заданным аллокатором (например, std::pmr::polymorphic_allocator)
+    explicit Vector(const Allocator& allocator) : data_(nullptr), size_(0), capacity_(0), alloc(allocator) {}
+
+    // Конструктор с указанием начального размера (элементы инициализируются значением по умолчанию)
+    explicit Vector(size_t initial_size, const Allocator& allocator = Allocator())
+        : data_(nullptr), size_(0), capacity_(0), alloc(allocator) {
+        resize(initial_size);
     }
-    
+
+    // Конструктор с указанием начального размера и значения элементов
+    Vector(size_t initial_size, const T& value, const Allocator& allocator = Allocator())
+        : data_(nullptr), size_(0), capacity_(0), alloc(allocator) {
+        resize(initial_size, value);
+    }
+
     // Копирующий конструктор
-    Vector(const Vector& other) : size_(other.size_), capacity_(other.capacity_) {
-        data = new T[capacity_];  // Выделяем память такого же размера
-        for (size_t i = 0; i < size_; ++i) {
-            data[i] = other.data[i];  // Копируем каждый элемент
+    Vector(const Vector& other)
+        : Vector(other, AllocTraits::select_on_container_copy_construction(other.alloc)) {}
+
+    // Копирующий конструктор с заданным аллокатором
+    Vector(const Vector& other, const Allocator& allocator)
+        : data_(nullptr), size_(0), capacity_(0), alloc(allocator) {
+        reserve(other.size_);  // Выделяем ровно столько, сколько нужно
+        for (size_t i = 0; i < other.size_; ++i) {
+            emplace_back(other.data_[i]);  // Копируем каждый элемент на место
         }
     }
-    
+
     // Перемещающий конструктор
-    Vector(Vector&& other) noexcept 
-        : data(other.data), size_(other.size_), capacity_(other.capacity_) {
+    Vector(Vector&& other) noexcept
+        : data_(other.data_), size_(other.size_), capacity_(other.capacity_), alloc(std::move(other.alloc)) {
         // Обнуляем указатели исходного вектора, чтобы избежать двойного удаления
-        other.data = nullptr;
+        other.data_ = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
     }
-    
+
     // Копирующий оператор присваивания
     Vector& operator=(const Vector& other) {
         // Проверка на самоприсваивание
         if (this != &other) {
-            delete[] data;  // Освобождаем текущую память
-            
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            data = new T[capacity_];  // Выделяем новую память
-            
-            // Копируем элементы
-            for (size_t i = 0; i < size_; ++i) {
-                data[i] = other.data[i];
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                // Буфер, выделенный другим аллокатором, новым не освободить
+                if (!(alloc == other.alloc)) {
+                    clear();
+                    deallocate(data_, capacity_);
+                    data_ = nullptr;
+                    capacity_ = 0;
+                }
+                alloc = other.alloc;
             }
+            // Текущий буфер переиспользуется, если его емкости хватает
+            assign_range(other.data_, other.size_);
         }
         return *this;  // Возвращаем ссылку на текущий объект
     }
-    
+
     // Перемещающий оператор присваивания
-    Vector& operator=(Vector&& other) noexcept {
+    Vector& operator=(Vector&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                               AllocTraits::is_always_equal::value) {
         if (this != &other) {
-            delete[] data;  // Освобождаем текущую память
-            
-            // Перехватываем ресурсы другого вектора
-            data = other.data;
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            
-            // Обнуляем указатели исходного вектора
-            other.data = nullptr;
-            other.size_ = 0;
-            other.capacity_ = 0;
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                clear();
+                deallocate(data_, capacity_);
+                data_ = nullptr;
+                capacity_ = 0;
+                alloc = std::move(other.alloc);
+                take_buffer(other);
+            } else if (alloc == other.alloc) {
+                take_buffer(other);
+            } else {
+                // Память другого аллокатора перехватить нельзя: перемещаем поэлементно
+                assign(std::make_move_iterator(other.data_), std::make_move_iterator(other.data_ + other.size_));
+                other.clear();
+            }
         }
         return *this;
     }
-    
+
     ~Vector() {
-        delete[] data;
+        clear();
+        deallocate(data_, capacity_);
+    }
+
+    // Обмен содержимым с другим вектором
+    void swap(Vector& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc, other.alloc);
+        }
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    Allocator get_allocator() const {
+        return alloc;
     }
-    
-    // Методы доступа к элементам 
+
+    // Методы доступа к элементам
     T& operator[](size_t index) {
         if (index >= size_) {
             throw std::out_of_range("Индекс вне диапазона");
         }
-        return data[index];  // Возвращаем ссылку на элемент
+        return data_[index];  // Возвращаем ссылку на элемент
     }
-    
-    // Оператор для константного доступа 
+
+    // Оператор для константного доступа
     const T& operator[](size_t index) const {
         if (index >= size_) {
             throw std::out_of_range("Индекс вне диапазона");
         }
-        return data[index];  // Возвращаем константную ссылку на элемент
+        return data_[index];  // Возвращаем константную ссылку на элемент
+    }
+
+    // Первый и последний элементы
+    T& front() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return data_[0];
+    }
+
+    const T& front() const {
+        return const_cast<Vector&>(*this).front();
+    }
+
+    T& back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Обращение к элементу пустого вектора");
+        }
+        return data_[size_ - 1];
+    }
+
+    const T& back() const {
+        return const_cast<Vector&>(*this).back();
+    }
+
+    // Указатель на буфер элементов (nullptr, если буфер не выделен)
+    T* data() {
+        return data_;
+    }
+
+    const T* data() const {
+        return data_;
+    }
+
+    // Конструирование элемента на месте в конце вектора
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ < capacity_) {
+            construct(data_ + size_, std::forward<Args>(args)...);
+        } else if constexpr (resizable_in_place) {
+            // Аргументы могут ссылаться на элементы, а буфер может переехать:
+            // сначала создаем временный объект
+            T tmp(std::forward<Args>(args)...);
+            reallocate(next_capacity(size_ + 1));
+            construct(data_ + size_, std::move(tmp));
+        } else {
+            // Новый элемент создается в новом буфере до переноса старых,
+            // поэтому аргументы могут ссылаться на элементы самого вектора
+            size_t new_capacity = next_capacity(size_ + 1);
+            T* new_data = allocate(new_capacity);
+            Stats::on_reallocate();
+            try {
+                construct(new_data + size_, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate(data_, size_, new_data);
+            } catch (...) {
+                destroy_one(new_data + size_);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+        }
+        return data_[size_++];
     }
-    
+
     // Добавление элемента в конец (для l-value)
     void push_back(const T& value) {
-        // Проверяем, нужно ли увеличить емкость
-        if (size_ >= capacity_) {
-            // Стратегия увеличения: если capacity == 0, устанавливаем в 2,
-            // иначе удваиваем 
-            size_t new_capacity = capacity_ == 0 ? 2 : capacity_ * 2;
-            reallocate(new_capacity);  // Перевыделяем память с новой емкостью
-        }
-        // Добавляем элемент в конец и увеличиваем размер
-        data[size_++] = value;
+        emplace_back(value);
     }
-    
+
     // Добавление элемента в конец (для r-value - с перемещением)
     void push_back(T&& value) {
-        if (size_ >= capacity_) {
-            size_t new_capacity = capacity_ == 0 ? 2 : capacity_ * 2;
-            reallocate(new_capacity);
+        emplace_back(std::move(value));
+    }
+
+    // Удаление последнего элемента
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("Удаление из пустого вектора");
         }
-        // Используем перемещение вместо копирования для эффективности
-        data[size_++] = std::move(value);
+        --size_;
+        destroy_one(data_ + size_);
     }
-    
-    // Вставка элемента в произвольную позицию (для l-value)
-    void insert(size_t pos, const T& value) {
+
+    // Конструирование элемента на месте в произвольной позиции
+    template<typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
         // Проверка корректности позиции
         if (pos > size_) {
             throw std::out_of_range("Позиция вставки вне диапазона");
         }
-        
-        // Проверяем, нужно ли увеличить емкость
+
+        if (pos == size_) {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+
+        if constexpr (resizable_in_place) {
+            if (size_ >= capacity_) {
+                T tmp(std::forward<Args>(args)...);
+                reallocate(next_capacity(size_ + 1));
+                return emplace(pos, std::move(tmp));
+            }
+        }
+
         if (size_ >= capacity_) {
-            size_t new_capacity = capacity_ == 0 ? 2 : capacity_ * 2;
-            reallocate(new_capacity);
+            // Строим новый буфер сразу с "дыркой" под вставляемый элемент,
+            // чтобы каждый элемент переносился ровно один раз
+            size_t new_capacity = next_capacity(size_ + 1);
+            T* new_data = allocate(new_capacity);
+            Stats::on_reallocate();
+            try {
+                construct(new_data + pos, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate_around(new_data, pos, 1);
+            } catch (...) {
+                destroy_one(new_data + pos);
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            ++size_;
+            return data_[pos];
         }
-        
-        // Сдвигаем элементы вправо, начиная с конца, чтобы освободить место
-        for (size_t i = size_; i > pos; --i) {
-            data[i] = std::move(data[i - 1]);
+
+        // Временный объект защищает от случая, когда аргумент ссылается
+        // на элемент, который сейчас будет сдвинут
+        T tmp(std::forward<Args>(args)...);
+        if constexpr (relocatable) {
+            // Сдвигаем хвост одним memmove и конструируем элемент на месте
+            move_bytes(data_ + pos + 1, data_ + pos, size_ - pos);
+            construct(data_ + pos, std::move(tmp));
+        } else {
+            // Последний элемент переносим в неинициализированный слот,
+            // остальные сдвигаем вправо присваиванием
+            construct(data_ + size_, std::move(data_[size_ - 1]));
+            for (size_t i = size_ - 1; i > pos; --i) {
+                assign_element(data_[i], std::move(data_[i - 1]));
+            }
+            assign_element(data_[pos], std::move(tmp));
         }
-        
-        // Вставляем новый элемент на освободившееся место
-        data[pos] = value;
         ++size_;  // Увеличиваем размер
+        return data_[pos];
+    }
+
+    // Вставка элемента в произвольную позицию (для l-value)
+    void insert(size_t pos, const T& value) {
+        emplace(pos, value);
     }
-    
+
     // Вставка элемента в произвольную позицию (для r-value)
     void insert(size_t pos, T&& value) {
-        if (pos > size_) {
-            throw std::out_of_range("Позиция вставки вне диапазона");
-        }
-        
-        if (size_ >= capacity_) {
-            size_t new_capacity = capacity_ == 0 ? 2 : capacity_ * 2;
-            reallocate(new_capacity);
-        }
-        
-        // Сдвигаем элементы вправо
-        for (size_t i = size_; i > pos; --i) {
-            data[i] = std::move(data[i - 1]);
-        }
-        
-        // Вставляем новый элемент с перемещением
-        data[pos] = std::move(value);
-        ++size_;
+        emplace(pos, std::move(value));
     }
-    
+
     // Удаление элемента по позиции
     void erase(size_t pos) {
         // Проверка корректности позиции
         if (pos >= size_) {
             throw std::out_of_range("Позиция удаления вне диапазона");
         }
-        
-        // Сдвигаем элементы влево, начиная с позиции после удаляемой
-        for (size_t i = pos; i < size_ - 1; ++i) {
-            data[i] = std::move(data[i + 1]);
+
+        if constexpr (relocatable) {
+            // Уничтожаем элемент и сдвигаем хвост одним memmove
+            destroy_one(data_ + pos);
+            move_bytes(data_ + pos, data_ + pos + 1, size_ - pos - 1);
+        } else {
+            // Сдвигаем элементы влево, начиная с позиции после удаляемой
+            for (size_t i = pos; i < size_ - 1; ++i) {
+                assign_element(data_[i], std::move(data_[i + 1]));
+            }
+            destroy_one(data_ + size_ - 1);
         }
-        
+
         --size_;
     }
-    
+
+    // Вставка диапазона [first, last) перед позицией pos: не больше одного
+    // перевыделения и один сдвиг хвоста сразу на k элементов.
+    // Диапазон не должен указывать на элементы самого вектора.
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void insert(size_t pos, InputIt first, InputIt last) {
+        if (pos > size_) {
+            throw std::out_of_range("Позиция вставки вне диапазона");
+        }
+        if constexpr (is_forward_iterator<InputIt>::value) {
+            insert_range(pos, first, static_cast<size_t>(std::distance(first, last)));
+        } else {
+            // Длина однопроходного диапазона неизвестна: сначала собираем
+            // элементы во временный вектор, затем переносим их одним блоком
+            Vector buffer(alloc);
+            for (; first != last; ++first) {
+                buffer.emplace_back(*first);
+            }
+            insert_range(pos, std::make_move_iterator(buffer.data_), buffer.size_);
+        }
+    }
+
+    // Добавление диапазона [first, last) в конец
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void append(InputIt first, InputIt last) {
+        insert(size_, first, last);
+    }
+
+    // Замена содержимого элементами диапазона [first, last)
+    template<typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void assign(InputIt first, InputIt last) {
+        if constexpr (is_forward_iterator<InputIt>::value) {
+            assign_range(first, static_cast<size_t>(std::distance(first, last)));
+        } else {
+            // Длина неизвестна: присваиваем живым элементам, остаток добавляем в конец
+            size_t i = 0;
+            for (; i < size_ && first != last; ++i, ++first) {
+                assign_element(data_[i], *first);
+            }
+            if (i < size_) {
+                destroy(data_ + i, data_ + size_);
+                size_ = i;
+            }
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    // Удаление элементов с позициями [first, last) одним сдвигом хвоста
+    void erase(size_t first, size_t last) {
+        if (first > last || last > size_) {
+            throw std::out_of_range("Диапазон удаления вне диапазона");
+        }
+        size_t count = last - first;
+        if (count == 0) {
+            return;
+        }
+
+        if constexpr (relocatable) {
+            destroy(data_ + first, data_ + last);
+            move_bytes(data_ + first, data_ + last, size_ - last);
+        } else {
+            for (size_t i = last; i < size_; ++i) {
+                assign_element(data_[i - count], std::move(data_[i]));
+            }
+            destroy(data_ + size_ - count, data_ + size_);
+        }
+        size_ -= count;
+    }
+
+    // Удаление всех элементов, удовлетворяющих предикату, за один проход.
+    // Возвращает количество удаленных элементов.
+    template<typename Predicate>
+    size_t erase_if(Predicate pred) {
+        return erase_where([this, &pred](size_t i) { return static_cast<bool>(pred(data_[i])); });
+    }
+
+    // Удаление элементов с позициями из [first, last) (в любом порядке, повторы
+    // допускаются) за один проход: O(n + k log k) вместо O(k * n) при
+    // удалении по одному. Возвращает количество удаленных элементов.
+    template<typename InputIt>
+    size_t erase_indices(InputIt first, InputIt last) {
+        std::vector<size_t> indices = sorted_index_set(first, last, size_);
+        if (indices.empty()) {
+            return 0;
+        }
+        if constexpr (relocatable) {
+            // Промежутки между удаляемыми позициями сдвигаются по одному memmove,
+            // элементы до первой удаляемой позиции не трогаются
+            size_t write = indices[0];
+            for (size_t j = 0; j < indices.size(); ++j) {
+                destroy_one(data_ + indices[j]);
+                size_t run_start = indices[j] + 1;
+                size_t run_end = j + 1 < indices.size() ? indices[j + 1] : size_;
+                if (run_start != run_end) {
+                    move_bytes(data_ + write, data_ + run_start, run_end - run_start);
+                }
+                write += run_end - run_start;
+            }
+            size_ = write;
+            return indices.size();
+        }
+        size_t next = 0;
+        return erase_where([&indices, &next](size_t i) {
+            if (next < indices.size() && indices[next] == i) {
+                ++next;
+                return true;
+            }
+            return false;
+        });
+    }
+
+    // Резервирование памяти минимум под new_capacity элементов
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Изменение размера: новые элементы инициализируются значением по умолчанию
+    void resize(size_t new_size) {
+        if (new_size < size_) {
+            destroy(data_ + new_size, data_ + size_);
+            size_ = new_size;
+            return;
+        }
+        reserve(new_size);
+        for (; size_ < new_size; ++size_) {
+            construct(data_ + size_);
+        }
+    }
+
+    // Изменение размера: новые элементы копируются из value
+    void resize(size_t new_size, const T& value) {
+        if (new_size < size_) {
+            destroy(data_ + new_size, data_ + size_);
+            size_ = new_size;
+            return;
+        }
+        if (new_size > capacity_) {
+            T copy(value);  // value может быть элементом самого вектора
+            reallocate(new_size);
+            for (; size_ < new_size; ++size_) {
+                construct(data_ + size_, copy);
+            }
+            return;
+        }
+        for (; size_ < new_size; ++size_) {
+            construct(data_ + size_, value);
+        }
+    }
+
+    // Освобождение неиспользуемой емкости
+    void shrink_to_fit() {
+        if (capacity_ > size_) {
+            if (size_ == 0) {
+                deallocate(data_, capacity_);
+                data_ = nullptr;
+                capacity_ = 0;
+            } else {
+                reallocate(size_);
+            }
+        }
+    }
+
+    // Удаление всех элементов (емкость сохраняется)
+    void clear() {
+        destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
     // Получение текущего количества элементов
     size_t size() const {
         return size_;
     }
-    
+
     // Получение текущей емкости
     size_t capacity() const {
         return capacity_;
     }
-    
-    class iterator {
-    private:
-        T* ptr;  // Указатель на текущий элемент
-        
-    public:
-        // Конструктор итератора
-        iterator(T* p) : ptr(p) {}
-        
-        // Оператор разыменования - доступ к текущему элементу
-        T& operator*() {
-            return *ptr;
-        }
-        
-        // Префиксный инкремент
-        iterator& operator++() {
-            ++ptr;  // Просто перемещаем указатель на следующий элемент
-            return *this;
-        }
-        
-        // Постфиксный инкремент 
-        iterator operator++(int) {
-            iterator temp = *this;  // Сохраняем текущее состояние
-            ++ptr;                  // Перемещаем указатель
-            return temp;            // Возвращаем старое состояние
-        }
-        
-        // Операторы сравнения для использования в циклах
-        bool operator!=(const iterator& other) const {
-            return ptr != other.ptr;
-        }
-        
-        bool operator==(const iterator& other) const {
-            return ptr == other.ptr;
-        }
-    };
-    
-    // Метод для получения итератора на начало вектора
+
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    // Память, занимаемая вектором: сам объект и буфер емкостью capacity().
+    // Память, которой владеют сами элементы (например, строки), не учитывается.
+    size_t memory_footprint() const {
+        return sizeof(*this) + capacity_ * sizeof(T);
+    }
+
+    // Счетчики политики статистики (для NoStats - пустой объект)
+    const Stats& stats() const {
+        return *this;
+    }
+
+    Stats& stats() {
+        return *this;
+    }
+
+    // Итераторы произвольного доступа (см. contiguous_iterator.h)
     iterator begin() {
-        return iterator(data);
+        return iterator(data_);
     }
-    
+
     iterator end() {
-        return iterator(data + size_);
+        return iterator(data_ + size_);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(data_);
+    }
+
+    const_iterator end() const {
+        return const_iterator(data_ + size_);
+    }
+
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    const_iterator cend() const {
+        return end();
+    }
+
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
     }
 };
 
-#endif
\ No newline at end of file
+// Вектор, память которого выделяется из std::pmr::memory_resource
+template<typename T, typename Stats = NoStats>
+using PmrVector = Vector<T, std::pmr::polymorphic_allocator<T>, Stats>;
+
+#endif
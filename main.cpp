@@ -1,8 +1,62 @@
 #include "include/vector.h"
+#include "include/small_vector.h"
+#include "include/incremental_vector.h"
 #include "include/list.h"
 #include "include/forward_list.h"
+#include "include/compact_list.h"
+#include "include/unrolled_list.h"
+#include "include/deque.h"
+#include "include/gap_vector.h"
+#include "include/intrusive_list.h"
+#include "include/intrusive_forward_list.h"
+#include "include/node_pool.h"
+#include "include/mmap_allocator.h"
+#include "include/mapped_vector.h"
+#include "include/concurrent_forward_list.h"
+#include "include/concurrent_vector.h"
+#include "include/parallel_algorithms.h"
+#include "include/aligned_allocator.h"
+#include "include/simd.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <iostream>
+#include <iterator>
+#include <numeric>
+#include <optional>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Включена ли у контейнера политика статистики (ContainerStats)
+template<typename Container, typename = void>
+struct has_enabled_stats : std::false_type {};
+
+template<typename Container>
+struct has_enabled_stats<Container, std::void_t<decltype(std::declval<Container&>().stats())>>
+    : std::bool_constant<std::decay_t<decltype(std::declval<Container&>().stats())>::enabled> {};
+
+// Есть ли у контейнера удаление набора позиций за один проход (erase_indices)
+template<typename Container, typename = void>
+struct has_erase_indices : std::false_type {};
+
+template<typename Container>
+struct has_erase_indices<Container, std::void_t<decltype(std::declval<Container&>().erase_indices(
+    std::declval<const size_t*>(), std::declval<const size_t*>()))>> : std::true_type {};
+
+// Отчет о выделениях памяти и операциях над элементами за прошедший этап.
+// Для контейнеров без статистики ничего не печатает.
+template<typename Container>
+void report_stats(Container& container, const std::string& phase) {
+    if constexpr (has_enabled_stats<Container>::value) {
+        std::cout << "Статистика этапа \"" << phase << "\" (занято памяти: "
+                  << container.memory_footprint() << " байт):" << std::endl;
+        container.stats().print(std::cout);
+        container.stats().reset();
+    }
+}
 
 template<typename Container>
 void demonstrate_container(const std::string& container_name) {
@@ -23,11 +77,17 @@ void demonstrate_container(const std::string& container_name) {
     
     // Вывод размера
     std::cout << "Размер контейнера: " << container.size() << std::endl;
+    report_stats(container, "добавление 0-9");
     
     // Удаление 3-го, 5-го и 7-го элементов
-    container.erase(6); 
-    container.erase(4);  
-    container.erase(2); 
+    if constexpr (has_erase_indices<Container>::value) {
+        const size_t positions[] = {6, 2, 4};  // Порядок позиций не важен
+        container.erase_indices(std::begin(positions), std::end(positions));
+    } else {
+        container.erase(6);
+        container.erase(4);
+        container.erase(2);
+    }
     
     // Вывод после удаления
     std::cout << "Содержимое после удаления: ";
@@ -35,6 +95,7 @@ void demonstrate_container(const std::string& container_name) {
         std::cout << *it << " ";
     }
     std::cout << std::endl;
+    report_stats(container, "удаление");
     
     // Добавление элемента 10 в начало
     container.insert(0, 10);
@@ -44,6 +105,7 @@ void demonstrate_container(const std::string& container_name) {
         std::cout << *it << " ";
     }
     std::cout << std::endl;
+    report_stats(container, "добавление 10 в начало");
     
     // Вычисление середины контейнера
     size_t middle = container.size() / 2;
@@ -54,6 +116,7 @@ void demonstrate_container(const std::string& container_name) {
         std::cout << *it << " ";
     }
     std::cout << std::endl;
+    report_stats(container, "добавление 20 в середину");
     
     // Добавление элемента 30 в конец
     container.push_back(30);
@@ -63,18 +126,710 @@ void demonstrate_container(const std::string& container_name) {
         std::cout << *it << " ";
     }
     std::cout << std::endl;
+    report_stats(container, "добавление 30 в конец");
     
     std::cout << "Итоговый размер: " << container.size() << std::endl;
     std::cout << std::endl;
 }
 
+// Несколько потоков одновременно добавляют элементы в ConcurrentForwardList,
+// затем половина извлекается по одному, а остаток - одной операцией take_all
+void demonstrate_concurrent_forward_list() {
+    std::cout << "Демонстрация ConcurrentForwardList (список без блокировок)" << std::endl;
+    ConcurrentForwardList<int> list;
+    const int thread_count = 4;
+    const int per_thread = 1000;
+    
+    std::vector<std::thread> producers;
+    for (int t = 0; t < thread_count; ++t) {
+        producers.emplace_back([&list, t] {
+            for (int i = 0; i < per_thread; i += 10) {
+                // Десять элементов вставляются в список одним CAS
+                ConcurrentForwardList<int>::Chain chain;
+                for (int k = 0; k < 10; ++k) {
+                    chain.push_back(t * per_thread + i + k);
+                }
+                list.push_front_batch(std::move(chain));
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    
+    long long sum = 0;
+    int popped = 0;
+    std::vector<std::thread> consumers;
+    std::vector<long long> sums(thread_count);
+    std::vector<int> counts(thread_count);
+    for (int t = 0; t < thread_count; ++t) {
+        consumers.emplace_back([&list, &sums, &counts, t] {
+            for (int i = 0; i < per_thread / 2; ++i) {
+                if (std::optional<int> value = list.pop_front()) {
+                    sums[t] += *value;
+                    ++counts[t];
+                }
+            }
+        });
+    }
+    for (int t = 0; t < thread_count; ++t) {
+        consumers[t].join();
+        sum += sums[t];
+        popped += counts[t];
+    }
+    
+    ForwardList<int> rest = list.take_all();
+    for (auto it = rest.begin(); it != rest.end(); ++it) {
+        sum += *it;
+    }
+    std::cout << "Извлечено по одному: " << popped << ", через take_all: " << rest.size() << std::endl;
+    std::cout << "Сумма элементов: " << sum << " (ожидалось "
+              << static_cast<long long>(thread_count) * per_thread * (thread_count * per_thread - 1) / 2
+              << ")" << std::endl;
+    std::cout << std::endl;
+}
+
+// Несколько потоков дописывают в общий ConcurrentVector; адреса элементов,
+// полученные до окончания записи, остаются действительными
+void demonstrate_concurrent_vector() {
+    std::cout << "Демонстрация ConcurrentVector (сегментированный вектор для нескольких потоков)" << std::endl;
+    ConcurrentVector<int> vector;
+    const int thread_count = 4;
+    const int per_thread = 1000;
+    const int* first = &vector[vector.push_back(-1)];
+    
+    std::vector<std::thread> writers;
+    for (int t = 0; t < thread_count; ++t) {
+        writers.emplace_back([&vector, t] {
+            for (int i = 0; i < per_thread; i += 10) {
+                // Десять соседних индексов резервируются одной операцией
+                vector.grow_by(10, t);
+            }
+        });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    
+    std::vector<int> per_writer(thread_count);
+    for (auto it = vector.begin(); it != vector.end(); ++it) {
+        if (*it >= 0) {
+            ++per_writer[*it];
+        }
+    }
+    std::cout << "Размер: " << vector.size() << ", элементов от каждого потока:";
+    for (int count : per_writer) {
+        std::cout << " " << count;
+    }
+    std::cout << std::endl;
+    std::cout << "Первый элемент не переместился: " << (first == &vector[0] ? "да" : "нет") << std::endl;
+    std::cout << std::endl;
+}
+
+// После череды удалений и вставок соседние узлы List разбросаны по куче;
+// relinearize() перестраивает их в порядке списка
+void demonstrate_relinearize() {
+    std::cout << "Демонстрация List::relinearize() (восстановление локальности узлов)" << std::endl;
+    List<int> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(i);
+    }
+    std::cout << "Средний шаг между узлами после заполнения: " << list.average_node_stride() << " байт" << std::endl;
+    
+    // Удаляем каждый третий элемент и вставляем новые в другие места:
+    // освободившиеся узлы достаются элементам из другой части списка
+    for (int round = 0; round < 3; ++round) {
+        int index = 0;
+        for (auto it = list.begin(); it != list.end(); ++index) {
+            it = index % 3 == round ? list.erase(it) : std::next(it);
+        }
+        for (auto it = list.begin(); list.size() < 1000; std::advance(it, 2)) {
+            it = list.insert(it, -1);
+        }
+    }
+    std::cout << "После удалений и вставок: " << list.average_node_stride() << " байт" << std::endl;
+    
+    List<int> copy(list);
+    list.relinearize();
+    std::cout << "После relinearize(): " << list.average_node_stride() << " байт, элементы "
+              << (std::equal(list.begin(), list.end(), copy.begin(), copy.end()) ? "не изменились" : "изменились")
+              << std::endl;
+    std::cout << std::endl;
+}
+
+// Повторное копирование снимка в один и тот же приемник: присваивание
+// переиспользует его буфер и узлы, выделения нужны только при росте
+template<typename Container>
+void demonstrate_snapshot(const std::string& container_name) {
+    Container source;
+    for (int i = 0; i < 1000; ++i) {
+        source.push_back(i);
+    }
+    Container snapshot;
+    snapshot = source;
+    snapshot.stats().reset();
+    for (int round = 0; round < 100; ++round) {
+        source.front() = round;
+        snapshot = source;
+    }
+    std::cout << container_name << ": 100 снимков по 1000 элементов - выделений памяти "
+              << snapshot.stats().allocations << ", присваиваний элементов " << snapshot.stats().copy_assignments;
+
+    // Снимок короче текущего: освобождаются только лишние узлы
+    const int shorter[] = {1, 2, 3};
+    snapshot.assign(std::begin(shorter), std::end(shorter));
+    std::cout << "; assign из 3 элементов - выделений " << snapshot.stats().allocations << std::endl;
+}
+
+void demonstrate_snapshot_assignment() {
+    std::cout << "Демонстрация копирующего присваивания с переиспользованием памяти" << std::endl;
+    demonstrate_snapshot<Vector<int, std::allocator<int>, ContainerStats>>("Vector");
+    demonstrate_snapshot<List<int, std::allocator<int>, ContainerStats>>("List");
+    demonstrate_snapshot<ForwardList<int, std::allocator<int>, ContainerStats>>("ForwardList");
+    demonstrate_snapshot<Deque<int, std::allocator<int>, ContainerStats>>("Deque");
+    std::cout << std::endl;
+}
+
+// Список в собственном пуле снимается целиком: discard_nodes() не
+// освобождает узлы по одному, release() возвращает блоки пула
+void demonstrate_pool_release() {
+    std::cout << "Демонстрация NodePool::release() (освобождение списка за O(числа блоков))" << std::endl;
+    NodePool pool;
+    PmrList<std::string> list{std::pmr::polymorphic_allocator<std::string>(&pool)};
+    for (int i = 0; i < 10000; ++i) {
+        list.push_back("элемент " + std::to_string(i));
+    }
+    std::cout << "Элементов: " << list.size() << ", блоков пула: " << pool.block_count() << std::endl;
+    list.discard_nodes();
+    pool.release();
+    std::cout << "После discard_nodes() и release(): элементов " << list.size()
+              << ", блоков пула " << pool.block_count() << std::endl;
+    std::cout << std::endl;
+}
+
+// Элемент со строкой в куче, копирование которого бросает исключение,
+// когда разрешенные копии закончились. Перемещающего конструктора нет,
+// поэтому контейнеры при переносе копируют его.
+struct ThrowingCopy {
+    static inline int copies_left = -1;  // Сколько копий еще разрешено (-1 - без ограничения)
+    std::string value;
+
+    explicit ThrowingCopy(int i) : value("элемент со строкой в куче " + std::to_string(i)) {}
+
+    ThrowingCopy(const ThrowingCopy& other) : value(allowed_copy(other.value)) {}
+
+    ThrowingCopy& operator=(const ThrowingCopy& other) {
+        value = allowed_copy(other.value);
+        return *this;
+    }
+
+    static const std::string& allowed_copy(const std::string& value) {
+        if (copies_left == 0) {
+            throw std::runtime_error("Копирование запрещено");
+        }
+        if (copies_left > 0) {
+            --copies_left;
+        }
+        return value;
+    }
+};
+
+template<typename Container>
+std::vector<std::string> values_of(const Container& container) {
+    std::vector<std::string> values;
+    for (const ThrowingCopy& element : container) {
+        values.push_back(element.value);
+    }
+    return values;
+}
+
+// Вставка insert в полный Vector при исключении на каждой по очереди копии:
+// вектор должен остаться прежним (утечки и двойное освобождение ловит ASan)
+template<typename Insert>
+bool check_failed_insert(Insert insert) {
+    for (int allowed = 0;; ++allowed) {
+        Vector<ThrowingCopy> vector;
+        for (int i = 0; i < 8; ++i) {
+            vector.push_back(ThrowingCopy(i));
+        }
+        vector.shrink_to_fit();
+        std::vector<std::string> before = values_of(vector);
+        ThrowingCopy::copies_left = allowed;
+        try {
+            insert(vector);
+            ThrowingCopy::copies_left = -1;
+            return true;  // Разрешенных копий хватило, все точки отказа пройдены
+        } catch (const std::runtime_error&) {
+            ThrowingCopy::copies_left = -1;
+        }
+        if (values_of(vector) != before) {
+            return false;
+        }
+    }
+}
+
+// UnrolledList после исключения при вставке: при добавлении в конец или
+// начало содержимое и число блоков не меняются, пустых блоков не остается;
+// при вставке с разбиением блока size() совпадает с числом элементов обхода
+bool check_unrolled_list_insert() {
+    using Chunked = UnrolledList<ThrowingCopy, 4>;
+    ThrowingCopy element(100);
+    for (int filled : {0, 4}) {  // Пустой список и один заполненный блок
+        for (bool front : {false, true}) {
+            Chunked list;
+            for (int i = 0; i < filled; ++i) {
+                list.push_back(ThrowingCopy(i));
+            }
+            std::vector<std::string> before = values_of(list);
+            ThrowingCopy::copies_left = 0;
+            try {
+                if (front) {
+                    list.push_front(element);
+                } else {
+                    list.push_back(element);
+                }
+            } catch (const std::runtime_error&) {
+            }
+            ThrowingCopy::copies_left = -1;
+            // Пустой блок в списке сделал бы обход бесконечным: сначала считаем блоки
+            if (list.chunk_count() != static_cast<size_t>(filled / 4) || values_of(list) != before) {
+                return false;
+            }
+        }
+    }
+    for (int allowed = 0;; ++allowed) {
+        Chunked list;
+        for (int i = 0; i < 4; ++i) {
+            list.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy::copies_left = allowed;
+        try {
+            list.insert(size_t(1), element);
+            ThrowingCopy::copies_left = -1;
+            return true;
+        } catch (const std::runtime_error&) {
+            ThrowingCopy::copies_left = -1;
+        }
+        if (list.size() != static_cast<size_t>(std::distance(list.begin(), list.end()))) {
+            return false;
+        }
+    }
+}
+
+// Вставка при исключении в копирующем конструкторе элемента
+bool demonstrate_exception_safety() {
+    std::cout << "Демонстрация вставки при исключении в копирующем конструкторе" << std::endl;
+    bool range_ok = check_failed_insert([](Vector<ThrowingCopy>& vector) {
+        ThrowingCopy range[] = {ThrowingCopy(100), ThrowingCopy(101)};
+        vector.insert(size_t(5), std::begin(range), std::end(range));
+    });
+    std::cout << "Vector::insert диапазона: " << (range_ok ? "вектор не изменился" : "ОШИБКА") << std::endl;
+    bool single_ok = check_failed_insert([](Vector<ThrowingCopy>& vector) {
+        ThrowingCopy element(100);
+        vector.insert(size_t(5), element);
+    });
+    std::cout << "Vector::insert элемента: " << (single_ok ? "вектор не изменился" : "ОШИБКА") << std::endl;
+    bool unrolled_ok = check_unrolled_list_insert();
+    std::cout << "UnrolledList: " << (unrolled_ok ? "пустых блоков не осталось, размер согласован" : "ОШИБКА")
+              << std::endl;
+    std::cout << std::endl;
+    return range_ok && single_ok && unrolled_ok;
+}
+
+// CompactList против List: память под 1000 элементов и перенумерация
+// слотов в порядке списка после вставок в начало
+void demonstrate_compact_list() {
+    std::cout << "Демонстрация CompactList (компактный список в массиве слотов)" << std::endl;
+    List<int> list;
+    CompactList<int> compact;
+    for (int i = 0; i < 1000; ++i) {
+        list.push_front(i);
+        compact.push_front(i);
+    }
+    std::cout << "Память на 1000 элементов: List " << list.memory_footprint()
+              << " байт, CompactList " << compact.memory_footprint() << " байт" << std::endl;
+    
+    // После вставок в начало список идет по массиву от конца к началу
+    auto stride = [&compact] {
+        const char* first = reinterpret_cast<const char*>(&*compact.begin());
+        const char* second = reinterpret_cast<const char*>(&*std::next(compact.begin()));
+        return second - first;
+    };
+    std::cout << "Шаг в байтах между первыми элементами до compact(): " << stride();
+    compact.compact();
+    std::cout << ", после: " << stride() << std::endl;
+    std::cout << "Содержимое совпадает с List: "
+              << (std::equal(list.begin(), list.end(), compact.begin(), compact.end()) ? "да" : "нет") << std::endl;
+    std::cout << std::endl;
+}
+
+// Объекты из заранее выделенного пула связываются во встраиваемые списки
+// без выделений памяти; один объект состоит в двух списках сразу
+struct Task {
+    int id;
+    ListHook queue_hook;         // Связь в очереди задач
+    ForwardListHook group_hook;  // Связь в группе задач
+};
+
+void demonstrate_intrusive_lists() {
+    std::cout << "Демонстрация IntrusiveList и IntrusiveForwardList (встраиваемые списки)" << std::endl;
+    std::vector<Task> pool(8);
+    for (int i = 0; i < 8; ++i) {
+        pool[i].id = i;
+    }
+    
+    IntrusiveList<Task, &Task::queue_hook> queue;
+    IntrusiveForwardList<Task, &Task::group_hook> even;
+    for (Task& task : pool) {
+        queue.push_back(task);
+        if (task.id % 2 == 0) {
+            even.push_front(task);
+        }
+    }
+    
+    // Удаление по ссылке на объект, без поиска
+    queue.unlink(pool[3]);
+    queue.unlink(pool[5]);
+    
+    IntrusiveList<Task, &Task::queue_hook> urgent;
+    urgent.push_back(pool[3]);
+    urgent.push_back(pool[5]);
+    queue.splice(queue.begin(), urgent);
+    
+    std::cout << "Очередь: ";
+    for (const Task& task : queue) {
+        std::cout << task.id << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "Четные задачи: ";
+    for (const Task& task : even) {
+        std::cout << task.id << " ";
+    }
+    std::cout << std::endl;
+    
+    // Безопасный режим обнаруживает повторную вставку связанного объекта
+    IntrusiveList<Task, &Task::queue_hook, true> checked;
+    Task extra{100, {}, {}};
+    checked.push_back(extra);
+    try {
+        checked.push_back(extra);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Повторная вставка: " << e.what() << std::endl;
+    }
+    checked.unlink(extra);
+    std::cout << "Размеры: очередь " << queue.size() << ", четные " << even.size()
+              << ", объект снова свободен: " << (extra.queue_hook.is_linked() ? "нет" : "да") << std::endl;
+    std::cout << std::endl;
+}
+
+// Алгоритмы стандартной библиотеки на итераторах контейнеров: категории
+// итераторов определяют, какие алгоритмы доступны
+void demonstrate_standard_algorithms() {
+    std::cout << "Демонстрация стандартных алгоритмов на итераторах контейнеров" << std::endl;
+    static_assert(std::is_same<std::iterator_traits<Vector<int>::iterator>::iterator_category,
+                               std::random_access_iterator_tag>::value, "Vector: произвольный доступ");
+    static_assert(std::is_same<std::iterator_traits<List<int>::iterator>::iterator_category,
+                               std::bidirectional_iterator_tag>::value, "List: двунаправленный");
+    static_assert(std::is_same<std::iterator_traits<ForwardList<int>::const_iterator>::iterator_category,
+                               std::forward_iterator_tag>::value, "ForwardList: однонаправленный");
+    
+    Vector<int> vector;
+    for (int i = 0; i < 10; ++i) {
+        vector.push_back((i * 7) % 10);
+    }
+    std::sort(vector.begin(), vector.end());
+    auto found = std::lower_bound(vector.cbegin(), vector.cend(), 6);
+    std::cout << "После std::sort: ";
+    for (int value : vector) {
+        std::cout << value << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "std::lower_bound(6) на позиции " << (found - vector.cbegin())
+              << ", front: " << vector.front() << ", back: " << vector.back() << std::endl;
+    std::cout << "В обратном порядке: ";
+    for (auto it = vector.rbegin(); it != vector.rend(); ++it) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+    
+    List<int> list;
+    for (int i = 1; i <= 5; ++i) {
+        list.push_back(i * i);
+    }
+    const List<int>& view = list;
+    auto square = std::find(view.begin(), view.end(), 16);
+    std::cout << "List: std::find(16) " << (square != view.end() ? "найден" : "не найден")
+              << ", сумма: " << std::accumulate(view.cbegin(), view.cend(), 0)
+              << ", последний через std::prev(end()): " << *std::prev(list.end()) << std::endl;
+    
+    ForwardList<int> forward;
+    forward.push_front(3);
+    forward.push_front(2);
+    forward.push_front(1);
+    std::cout << "ForwardList: front " << forward.front() << ", back " << forward.back() << ", std::distance: "
+              << std::distance(forward.cbegin(), forward.cend()) << std::endl;
+    std::cout << std::endl;
+}
+
+// Параллельные алгоритмы над Vector на пуле из четырех потоков;
+// результаты сверяются с последовательным вычислением
+bool demonstrate_parallel_algorithms() {
+    std::cout << "Демонстрация параллельных алгоритмов (пул с перехватом работы)" << std::endl;
+    ThreadPool pool(4);
+    parallel::Options options;
+    options.pool = &pool;
+    options.grain = 1000;  // Мелкие блоки, чтобы работа разошлась по потокам
+    
+    Vector<long long> values;
+    for (long long i = 0; i < 100000; ++i) {
+        values.push_back((i * 7919) % 100003);
+    }
+    
+    Vector<long long> squares;
+    parallel::transform(values, squares, [](long long x) { return x * x % 1000; }, options);
+    long long expected = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        expected += values[i] * values[i] % 1000;
+    }
+    long long sum = parallel::reduce(squares, 0LL, std::plus<>(), options);
+    bool sum_ok = sum == expected;
+    std::cout << "Сумма остатков квадратов: " << sum << (sum_ok ? " (совпадает)" : " (ошибка)") << std::endl;
+    
+    auto is_even = [](long long x) { return x % 2 == 0; };
+    size_t even = parallel::count_if(values, is_even, options);
+    bool count_ok = even == static_cast<size_t>(std::count_if(values.cbegin(), values.cend(), is_even));
+    std::cout << "Четных элементов: " << even << (count_ok ? " (совпадает)" : " (ошибка)") << std::endl;
+    
+    // Префиксные суммы сверяются целиком, а не только последняя
+    Vector<long long> prefix;
+    parallel::inclusive_scan(squares, prefix, std::plus<>(), options);
+    std::vector<long long> sequential_prefix(squares.size());
+    std::inclusive_scan(squares.cbegin(), squares.cend(), sequential_prefix.begin());
+    bool scan_ok = prefix.size() == sequential_prefix.size()
+                   && std::equal(prefix.cbegin(), prefix.cend(), sequential_prefix.cbegin());
+    std::cout << "Последняя префиксная сумма: " << prefix[prefix.size() - 1]
+              << (scan_ok ? " (совпадает)" : " (ошибка)") << std::endl;
+    
+    parallel::sort(values, std::less<>(), options);
+    bool sorted = true;
+    for (size_t i = 1; i < values.size(); ++i) {
+        sorted = sorted && values[i - 1] <= values[i];
+    }
+    std::cout << "Отсортирован: " << (sorted ? "да" : "нет") << ", первые элементы: "
+              << values[0] << " " << values[1] << " " << values[2] << std::endl;
+    
+    // Отмена: флаг взведен заранее, алгоритм бросает OperationCancelled
+    CancellationToken token;
+    token.cancel();
+    options.cancellation = &token;
+    bool cancelled = false;
+    try {
+        parallel::for_each(values, [](long long& x) { ++x; }, options);
+        std::cout << "for_each не прерван" << std::endl;
+    } catch (const OperationCancelled& e) {
+        std::cout << "for_each прерван: " << e.what() << std::endl;
+        cancelled = true;
+    }
+    std::cout << std::endl;
+    return sum_ok && count_ok && scan_ok && sorted && cancelled;
+}
+
+// Результаты векторных ядер на наборе инструкций isa против последовательного
+// цикла: разные длины (с остатком меньше регистра) и сдвиг на один элемент от
+// выровненного начала. Данные подобраны так, что суммы и произведения float
+// и double точны, поэтому результаты сравниваются на точное равенство.
+template<typename T>
+bool check_simd_kernels(simd::Isa isa) {
+    struct Results {
+        simd::sum_t<T> sum, dot;
+        T min, max;
+        std::pair<T, T> minmax;
+        size_t found, missing, count;
+        std::vector<T> filled, added, multiplied, fused;
+        
+        bool operator==(const Results& o) const {
+            return sum == o.sum && dot == o.dot && min == o.min && max == o.max && minmax == o.minmax &&
+                   found == o.found && missing == o.missing && count == o.count && filled == o.filled &&
+                   added == o.added && multiplied == o.multiplied && fused == o.fused;
+        }
+    };
+    
+    for (size_t n : {1, 3, 17, 64, 1000, 4099}) {
+        for (size_t offset : {0, 1}) {
+            AlignedVector<T> a, b, c, out;
+            for (size_t i = 0; i < n + offset; ++i) {
+                if constexpr (std::is_integral<T>::value) {
+                    // Большие значения: проверка 64-битных сумм и знаковых произведений
+                    a.push_back(static_cast<T>(i * 2654435761u));
+                    b.push_back(static_cast<T>(i * 40503u + 7) - 20000);
+                } else {
+                    a.push_back(static_cast<T>(static_cast<int>(i * 37 % 101) - 50) / 8);
+                    b.push_back(static_cast<T>(static_cast<int>(i * 11 % 23) - 11) / 8);
+                }
+                c.push_back(static_cast<T>(i % 5));
+            }
+            out.resize(n + offset);
+            const T* pa = &a[offset];
+            const T* pb = &b[offset];
+            const T* pc = &c[offset];
+            T* po = &out[offset];
+            
+            auto run = [&](simd::Isa level) {
+                simd::set_isa(level);
+                Results r;
+                r.sum = simd::sum(pa, n);
+                r.dot = simd::dot(pa, pb, n);
+                r.min = simd::min(pa, n);
+                r.max = simd::max(pa, n);
+                r.minmax = simd::minmax(pb, n);
+                r.found = simd::find(pa, n, pa[n - 1]);
+                r.missing = simd::find(pc, n, T(7));
+                r.count = simd::count(pc, n, T(3));
+                simd::fill(po, n, T(42));
+                r.filled.assign(po, po + n);
+                simd::add(pa, pb, po, n);
+                r.added.assign(po, po + n);
+                simd::mul(pb, pc, po, n);
+                r.multiplied.assign(po, po + n);
+                simd::fma(pb, pc, pa, po, n);
+                r.fused.assign(po, po + n);
+                return r;
+            };
+            if (!(run(simd::Isa::Scalar) == run(isa))) {
+                simd::set_isa(simd::detected_isa());
+                return false;
+            }
+        }
+    }
+    simd::set_isa(simd::detected_isa());
+    return true;
+}
+
+// Векторные ядра для Vector<int>/<float>/<double> на каждом доступном наборе
+// инструкций сверяются с последовательным циклом
+bool demonstrate_simd_kernels() {
+    std::cout << "Демонстрация векторных ядер (SIMD)" << std::endl;
+    std::cout << "Набор инструкций процессора: " << simd::isa_name(simd::detected_isa()) << std::endl;
+    
+    Vector<float> prices;
+    Vector<float> amounts;
+    for (int i = 1; i <= 10; ++i) {
+        prices.push_back(i * 1.5f);
+        amounts.push_back(static_cast<float>(i % 3));
+    }
+    auto range = simd::minmax(prices);
+    std::cout << "Сумма цен: " << simd::sum(prices) << ", выручка (dot): " << simd::dot(prices, amounts)
+              << ", цены от " << range.first << " до " << range.second << std::endl;
+    
+    bool ok = true;
+    for (simd::Isa isa : {simd::Isa::Sse2, simd::Isa::Avx2, simd::Isa::Avx512}) {
+        if (isa > simd::detected_isa()) {
+            break;
+        }
+        bool same = check_simd_kernels<int>(isa) && check_simd_kernels<float>(isa) && check_simd_kernels<double>(isa);
+        std::cout << simd::isa_name(isa) << ": " << (same ? "совпадает с последовательным циклом" : "РАСХОЖДЕНИЕ")
+                  << std::endl;
+        ok = ok && same;
+    }
+    std::cout << std::endl;
+    return ok;
+}
+
+#ifdef MAPPED_VECTOR_SUPPORTED
+// Запись MappedVector в файл и повторное открытие только для чтения
+void demonstrate_mapped_vector() {
+    std::cout << "Демонстрация MappedVector (вектор в отображенном в память файле)" << std::endl;
+    std::string path = (std::filesystem::temp_directory_path() / "containers_demo_mapped.bin").string();
+    std::remove(path.c_str());
+    {
+        MappedVector<int> vector(path);
+        for (int i = 0; i < 10; ++i) {
+            vector.push_back(i * i);
+        }
+        vector.flush();
+    }
+    
+    // Режим ReadOnly задается типом: элементы доступны только для чтения
+    MappedVector<int, MapMode::ReadOnly> reopened(path);
+    static_assert(std::is_same<decltype(reopened[0]), const int&>::value,
+                  "Элементы MappedVector в режиме ReadOnly доступны только для чтения");
+    std::cout << "Содержимое после повторного открытия: ";
+    for (const int& value : reopened) {
+        std::cout << value << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "Размер: " << reopened.size() << ", емкость: " << reopened.capacity()
+              << ", последний элемент: " << reopened[reopened.size() - 1] << std::endl;
+    try {
+        reopened.push_back(5);
+        std::cout << "Добавление в файл только для чтения не отклонено" << std::endl;
+    } catch (const std::logic_error&) {
+        std::cout << "Добавление в файл только для чтения отклонено" << std::endl;
+    }
+    std::remove(path.c_str());
+    std::cout << std::endl;
+}
+#endif
+
 int main() {
     std::cout << "Тестирование пользовательских контейнеров " << std::endl;
     std::cout << std::endl;
     demonstrate_container<Vector<int>>("Vector (последовательный контейнер)");
+    demonstrate_container<SmallVector<int, 16>>("SmallVector (вектор со встроенным буфером)");
+    demonstrate_container<IncrementalVector<int>>("IncrementalVector (вектор с постепенным переносом)");
     demonstrate_container<List<int>>("List (двунаправленный список)");
+    demonstrate_container<CompactList<int>>("CompactList (список в массиве слотов с 32-битными связями)");
     demonstrate_container<ForwardList<int>>("ForwardList (однонаправленный список)");
+    demonstrate_container<UnrolledList<int, 4>>("UnrolledList (развернутый список)");
+    demonstrate_container<Deque<int>>("Deque (двусторонняя очередь из блоков)");
+    demonstrate_container<GapVector<int>>("GapVector (вектор с разрывом в позиции правки)");
+    
+    // Те же списки, но узлы выделяются из пула блоками
+    NodePool pool;
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(&pool);
+    demonstrate_container<PmrList<int>>("List с пулом узлов (NodePool)");
+    demonstrate_container<PmrForwardList<int>>("ForwardList с пулом узлов (NodePool)");
+    std::pmr::set_default_resource(previous);
+    demonstrate_pool_release();
+    
+    // Контейнеры со счетчиками выделений памяти, копирований и перемещений
+    demonstrate_container<Vector<int, std::allocator<int>, ContainerStats>>("Vector со статистикой");
+    demonstrate_container<List<int, std::allocator<int>, ContainerStats>>("List со статистикой");
+    demonstrate_container<CompactList<int, std::allocator<int>, ContainerStats>>("CompactList со статистикой");
+    demonstrate_container<ForwardList<int, std::allocator<int>, ContainerStats>>("ForwardList со статистикой");
+    demonstrate_container<Deque<int, std::allocator<int>, ContainerStats>>("Deque со статистикой");
+    
+    // Другие политики роста емкости и рост буфера через mremap
+    demonstrate_container<Vector<int, std::allocator<int>, NoStats, HalfGrowth>>("Vector с ростом в 1.5 раза");
+    demonstrate_container<HugeVector<int, ContainerStats>>("HugeVector (mmap/mremap, емкость кратна странице)");
+    
+    demonstrate_concurrent_forward_list();
+    demonstrate_concurrent_vector();
+    demonstrate_relinearize();
+    demonstrate_snapshot_assignment();
+    bool exceptions_ok = demonstrate_exception_safety();
+    demonstrate_compact_list();
+    demonstrate_intrusive_lists();
+    demonstrate_standard_algorithms();
+    bool parallel_ok = demonstrate_parallel_algorithms();
+    bool simd_ok = demonstrate_simd_kernels();
     
+#ifdef MAPPED_VECTOR_SUPPORTED
+    demonstrate_mapped_vector();
+#endif
+    
+    if (!exceptions_ok) {
+        std::cout << "Вставка при исключении изменила контейнер" << std::endl;
+        return 1;
+    }
+    if (!parallel_ok) {
+        std::cout << "Параллельные алгоритмы расходятся с последовательным вычислением" << std::endl;
+        return 1;
+    }
+    if (!simd_ok) {
+        std::cout << "Векторные ядра расходятся с последовательным циклом" << std::endl;
+        return 1;
+    }
     std::cout << "Все тесты завершены успешно!" << std::endl;
     return 0;
 }
\ No newline at end of file